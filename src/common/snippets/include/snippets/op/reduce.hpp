@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Generated by Canonicalization for a reduction over the innermost dimension with kept dims.
+ * The input is accumulated into the output register lane-wise during the tile, the lanes are combined by HorizonReduce
+ * after the vector tile, so the result is available only to the ops executed after the whole row is processed.
+ * @ingroup snippets
+ */
+class Reduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reduce", "SnippetsOpset");
+
+    enum class Kind {
+        Sum,
+        Max
+    };
+
+    Reduce(const Output<Node>& x, Kind kind);
+    Reduce() = default;
+
+    Kind get_kind() const {
+        return m_kind;
+    }
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+private:
+    Kind m_kind = Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -0,0 +1,35 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "snippets/op/reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ScalarReduce
+ * @brief Generated by the Generator for the scalar tile of a reduction stage. The accumulator is already combined by
+ * HorizonReduce, so only the lane 0 of the input is accumulated and the result is broadcasted to all the lanes.
+ * @ingroup snippets
+ */
+class ScalarReduce : public Reduce {
+public:
+    OPENVINO_OP("ScalarReduce", "SnippetsOpset", ngraph::snippets::op::Reduce);
+
+    ScalarReduce(const Output<Node>& x, Kind kind);
+    ScalarReduce() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<ScalarReduce>(new_args.at(0), get_kind());
+    }
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
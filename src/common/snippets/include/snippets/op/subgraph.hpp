@@ -88,6 +88,9 @@ public:
         return m_generator;
     }
 
+    // true if the body contains reductions over the innermost dimension, such a body can be scheduled only by rows
+    bool has_reductions() const;
+
 
     snippets::Schedule generate(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes,
                                 ngraph::pass::Manager& opt, const void* compile_params = nullptr);
@@ -0,0 +1,36 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+size_t GetReductionStage(const std::shared_ptr<const Node>& node);
+/**
+ * @brief Returns the ops of the model ordered by reduction stages, the order inside a stage is topological
+ */
+NodeVector GetStageOrderedOps(const std::shared_ptr<ov::Model>& m);
+
+/**
+ * @interface AssignReductionStages
+ * @brief A body with reductions is executed as several consecutive passes (stages) over the innermost dimension:
+ * the result of snippets::op::Reduce is ready only after its stage is completed, so its consumers are executed in the following stages.
+ * The pass assigns a stage to every op. Loads, scalars and elementwise ops consumed in several stages are cloned,
+ * so the only values which cross the stage boundaries are the reduction results.
+ * Must be applied after all the other snippets dialect transformations.
+ * @ingroup snippets
+ */
+class AssignReductionStages : public ngraph::pass::FunctionPass {
+public:
+    OPENVINO_RTTI("AssignReductionStages", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
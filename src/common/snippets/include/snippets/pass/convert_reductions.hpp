@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ConvertReductions
+ * @brief Replaces ReduceSum, ReduceMax and ReduceMean over the innermost dimension with snippets::op::Reduce.
+ * ReduceMean is represented as a sum multiplied by a scalar. Must be applied before ConvertConstantsToScalars,
+ * so the reduction axes are not converted to scalars.
+ * @ingroup snippets
+ */
+class ConvertReductions: public ngraph::pass::MatcherPass {
+public:
+    ConvertReductions();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
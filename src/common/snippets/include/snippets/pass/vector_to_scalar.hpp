@@ -35,6 +35,18 @@ public:
     ReplaceStoresWithScalarStores();
 };
 
+/**
+ * @interface ReplaceReducesWithScalarReduces
+ * @brief Replaces vector reductions with scalar versions, which accumulate the lane 0 into the horizontally reduced
+ * accumulator.
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class ReplaceReducesWithScalarReduces: public ngraph::pass::MatcherPass {
+public:
+    ReplaceReducesWithScalarReduces();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
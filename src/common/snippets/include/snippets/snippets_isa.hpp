@@ -11,13 +11,16 @@
 #include "op/blockedparameter.hpp"
 #include "op/broadcastload.hpp"
 #include "op/broadcastmove.hpp"
+#include "op/horizon_reduce.hpp"
 #include "op/kernel.hpp"
 #include "op/load.hpp"
 #include "op/nop.hpp"
 #include "op/scalar.hpp"
+#include "op/scalar_reduce.hpp"
 #include "op/scalarload.hpp"
 #include "op/scalarstore.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reduce.hpp"
 #include "op/store.hpp"
 #include "op/tile.hpp"
 #include "op/vectorload.hpp"
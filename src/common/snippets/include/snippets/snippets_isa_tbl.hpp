@@ -24,6 +24,10 @@ NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
+NGRAPH_OP(Reduce, ngraph::snippets::op)
+NGRAPH_OP(ScalarReduce, ngraph::snippets::op)
+NGRAPH_OP(HorizonReduce, ngraph::snippets::op)
+
 // Layout-oblivious from opset1
 
 // opset completeness
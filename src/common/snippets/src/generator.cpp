@@ -6,12 +6,14 @@
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
 #include "snippets/pass/insert_load_store.hpp"
-#include "snippets/op/tile.hpp"
-#include "snippets/op/kernel.hpp"
+#include "snippets/pass/assign_reduction_stages.hpp"
+#include "snippets/snippets_isa.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
 
+#include <limits>
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
     auto rt = n->get_rt_info();
@@ -50,12 +52,22 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto out = results.size();
     auto nptrs = in + out;
 
+    using LoweredRegion = std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>>;
+    // every reduction stage is emitted as a separate pair of tiles, see AssignReductionStages
+    auto lower_by_stages = [this](const std::shared_ptr<ov::Model>& model) {
+        std::vector<LoweredRegion> stages;
+        for (auto n : ngraph::snippets::pass::GetStageOrderedOps(model)) {
+            const auto stage = ngraph::snippets::pass::GetReductionStage(n);
+            if (stages.size() <= stage)
+                stages.resize(stage + 1);
+            stages[stage].push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        }
+        return stages;
+    };
+
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
-    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
-    for (auto n : m->get_ordered_ops()) {
-        lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
-    }
+    std::vector<LoweredRegion> lowered = lower_by_stages(m);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
 
     // scalar tile
@@ -63,24 +75,77 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     ngraph::pass::Manager mng;
     mng.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
     mng.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    mng.register_pass<ngraph::snippets::pass::ReplaceReducesWithScalarReduces>();
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
-    for (auto n : m_scalar->get_ordered_ops()) {
-        scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
-    }
+    std::vector<LoweredRegion> scalar_lowered = lower_by_stages(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
 
+    // Input pointers are advanced by the loads of every stage, so the pointers which are read again
+    // by the following stages should be returned to the beginning of the row
+    std::vector<size_t> advanced_ptrs(lowered.size(), 0);
+    std::vector<std::vector<std::shared_ptr<op::Reduce>>> reductions(lowered.size());
+    // A stage after a reduction which reads no data along the row (e.g. it only stores the reduced values) computes
+    // the same values for the whole row, so it is executed once per row by the outer tile instead of the inner tiles
+    std::vector<bool> once_per_row(lowered.size(), true);
+    once_per_row[0] = false;
+    for (const auto& n : m->get_ordered_ops()) {
+        const auto stage = ngraph::snippets::pass::GetReductionStage(n);
+        if (auto reduce = ov::as_type_ptr<op::Reduce>(n)) {
+            reductions[stage].push_back(reduce);
+            once_per_row[stage] = false;
+        } else if (ov::is_type<op::Load>(n) && n->get_input_shape(0).back() != 1) {
+            once_per_row[stage] = false;
+            auto param = ov::as_type_ptr<opset1::Parameter>(n->get_input_node_shared_ptr(0));
+            if (param)
+                advanced_ptrs[stage] |= size_t(1) << m->get_parameter_index(param);
+        }
+    }
+
     // wrapping into tiles1D
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D;
-    auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                                   std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
-    tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                    std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    LoweredRegion tiles1D;
+    LoweredRegion reduction_lowered;
+    size_t reread_ptrs = 0;
+    for (size_t stage = lowered.size(); stage-- > 0;) {
+        // the scalar ops load and store the reduced values without the pointer shifts
+        if (once_per_row[stage]) {
+            tiles1D.insert(tiles1D.begin(), scalar_lowered[stage].begin(), scalar_lowered[stage].end());
+            continue;
+        }
+        LoweredRegion stage_tiles;
+        // accumulators initialization
+        for (const auto& reduce : reductions[stage]) {
+            std::shared_ptr<Node> node = reduce;
+            const auto acc = getRegisters(node).second;
+            const float init = reduce->get_kind() == op::Reduce::Kind::Max ? -std::numeric_limits<float>::infinity() : 0.f;
+            auto scalar = std::make_shared<op::Scalar>(element::f32, Shape{1}, init);
+            reduction_lowered.push_back(std::make_pair(target->get(op::Scalar::get_type_info_static())(scalar),
+                                                       std::make_pair(std::vector<size_t>{}, acc)));
+            stage_tiles.push_back(reduction_lowered.back());
+        }
+        auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered[stage]);
+        tile->compile_params = compile_params;
+        stage_tiles.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                       std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
+        // the lanes are combined before the scalar tile, its ScalarReduce ops accumulate the tail into the combined value
+        for (const auto& reduce : reductions[stage]) {
+            std::shared_ptr<Node> node = reduce;
+            const auto acc = getRegisters(node).second;
+            auto horizon = std::make_shared<op::HorizonReduce>(reduce->get_kind());
+            reduction_lowered.push_back(std::make_pair(target->get(op::HorizonReduce::get_type_info_static())(horizon),
+                                                       std::make_pair(acc, acc)));
+            stage_tiles.push_back(reduction_lowered.back());
+        }
+        std::vector<size_t> scalar_tile_args{1, target->get_lanes(), nptrs, 1};
+        if (advanced_ptrs[stage] & reread_ptrs)
+            scalar_tile_args.push_back(advanced_ptrs[stage] & reread_ptrs);
+        tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered[stage]);
+        tile->compile_params = compile_params;
+        stage_tiles.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                        std::make_pair(scalar_tile_args, std::vector<size_t>{})));
+        tiles1D.insert(tiles1D.begin(), stage_tiles.begin(), stage_tiles.end());
+        reread_ptrs |= advanced_ptrs[stage];
+    }
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
@@ -98,8 +163,11 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     kernel->emit_code({in, out}, {});
     OV_ITT_TASK_NEXT(GENERATE, "::EmitData")
     lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
-    for (auto& op : lowered) {
-        op.first->emit_data();
+    lowered.push_back(reduction_lowered);
+    for (auto& region : lowered) {
+        for (auto& op : region) {
+            op.first->emit_data();
+        }
     }
     OV_ITT_TASK_NEXT(GENERATE, "::GetSnippet")
     return target->get_snippet();
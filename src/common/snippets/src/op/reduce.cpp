@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/reduce.hpp"
+#include "snippets/op/scalar_reduce.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Reduce::Reduce(const Output<Node>& x, Kind kind) : Op({x}), m_kind(kind) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::Reduce::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(Reduce);
+    std::string kind = m_kind == Kind::Max ? "max" : "sum";
+    visitor.on_attribute("kind", kind);
+    m_kind = kind == "max" ? Kind::Max : Kind::Sum;
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::Reduce::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(Reduce);
+    check_new_args_count(this, new_args);
+    return std::make_shared<Reduce>(new_args.at(0), m_kind);
+}
+
+void snippets::op::Reduce::validate_and_infer_types() {
+    auto shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().is_static() && shape.rank().get_length() > 0,
+                          "Reduce expects an input of static non-zero rank");
+    shape[shape.rank().get_length() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), shape);
+}
+
+snippets::op::ScalarReduce::ScalarReduce(const Output<Node>& x, Kind kind) : Reduce(x, kind) {
+}
@@ -6,15 +6,19 @@
 #include "snippets/remarks.hpp"
 
 #include "snippets/op/subgraph.hpp"
+#include "snippets/op/reduce.hpp"
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/load_movebroadcast_to_broadcastload.hpp"
 #include "snippets/pass/assign_registers.hpp"
+#include "snippets/pass/assign_reduction_stages.hpp"
+#include "snippets/pass/convert_reductions.hpp"
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
 
 #include <ngraph/pass/manager.hpp>
+#include <openvino/op/util/arithmetic_reductions_keep_dims.hpp>
 #include <openvino/pass/serialize.hpp>
 
 #include <algorithm>
@@ -213,10 +217,24 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
                                                                ::ngraph::op::AutoBroadcastType::NUMPY);
         NODE_VALIDATION_CHECK(this, compatibleWithOtherOutputs, "Snippets output shapes must be numpy broadcastable");
     }
+    // The reduced dimension is present only in the inputs, but it has to be iterated over
+    if (has_reductions()) {
+        for (const auto& param : m_body->get_parameters()) {
+            NODE_VALIDATION_CHECK(this, PartialShape::broadcast_merge_into(outPShape, param->get_shape(), ::ngraph::op::AutoBroadcastType::NUMPY),
+                                  "Snippets input shapes must be numpy broadcastable to the output shapes");
+        }
+    }
     exec_domain = outPShape.get_shape();
     return exec_domain;
 }
 
+bool snippets::op::Subgraph::has_reductions() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& n) {
+        return ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(n) || ov::is_type<snippets::op::Reduce>(n);
+    });
+}
+
 void snippets::op::Subgraph::convert_to_snippet_dialect() {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::convert_to_snippet_dialect")
@@ -224,6 +242,7 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         return n->get_input_shape(0).back() != 1;
     };
     ngraph::pass::Manager manager;
+    manager.register_pass<snippets::pass::ConvertReductions>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
@@ -284,6 +303,7 @@ snippets::Schedule snippets::op::Subgraph::generate(ngraph::pass::Manager& opt,
     opt.run_passes(m_body);
 
     // generation flow
+    snippets::pass::AssignReductionStages().run_on_model(m_body);
     snippets::pass::AssignRegisters().run_on_model(m_body);
 
     // schedule generation should go here and be target agnostic
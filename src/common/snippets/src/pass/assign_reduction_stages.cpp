@@ -0,0 +1,90 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/pass/assign_reduction_stages.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include <algorithm>
+
+namespace {
+const char* const reduction_stage_key = "ReductionStage";
+
+void set_stage(const std::shared_ptr<ngraph::Node>& node, size_t stage) {
+    node->get_rt_info()[reduction_stage_key] = static_cast<int64_t>(stage);
+}
+} // namespace
+
+size_t ngraph::snippets::pass::GetReductionStage(const std::shared_ptr<const Node>& node) {
+    const auto& rt = node->get_rt_info();
+    const auto it = rt.find(reduction_stage_key);
+    if (it == rt.end())
+        return 0;
+    return static_cast<size_t>(it->second.as<int64_t>());
+}
+
+ngraph::NodeVector ngraph::snippets::pass::GetStageOrderedOps(const std::shared_ptr<ov::Model>& m) {
+    auto ops = m->get_ordered_ops();
+    std::stable_sort(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& lhs, const std::shared_ptr<Node>& rhs) {
+        return GetReductionStage(lhs) < GetReductionStage(rhs);
+    });
+    return NodeVector(ops.begin(), ops.end());
+}
+
+bool ngraph::snippets::pass::AssignReductionStages::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    RUN_ON_FUNCTION_SCOPE(AssignReductionStages);
+    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::AssignReductionStages")
+    const auto ops = m->get_ordered_ops();
+    if (std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& n) { return ov::is_type<op::Reduce>(n); }))
+        return false;
+
+    // the earliest stage the op can be executed in: all the reductions it depends on must be completed
+    std::map<std::shared_ptr<Node>, size_t> level;
+    for (const auto& n : ops) {
+        size_t l = 0;
+        for (const auto& input : n->input_values()) {
+            const auto& source = input.get_node_shared_ptr();
+            l = std::max(l, level[source] + (ov::is_type<op::Reduce>(source) ? 1 : 0));
+        }
+        level[n] = l;
+    }
+
+    // Reductions and stores are executed as early as possible, the other ops are executed in the stages of their consumers.
+    // The consumers are visited before the producers, so the stages of all the consumers (and their clones) are known.
+    std::map<std::shared_ptr<Node>, size_t> stage;
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it) {
+        const auto& n = *it;
+        if (ov::is_type<opset1::Parameter>(n)) {
+            continue;
+        } else if (ov::is_type<op::Reduce>(n) || ov::is_type<op::Store>(n) || ov::is_type<opset1::Result>(n)) {
+            stage[n] = level[n];
+        } else {
+            std::map<size_t, std::vector<Input<Node>>> consumers;
+            for (const auto& output : n->outputs()) {
+                for (const auto& consumer : output.get_target_inputs()) {
+                    consumers[stage.at(consumer.get_node()->shared_from_this())].push_back(consumer);
+                }
+            }
+            NGRAPH_CHECK(!consumers.empty(), "Snippets op ", n->get_friendly_name(), " has no consumers");
+            stage[n] = consumers.begin()->first;
+            for (auto c = std::next(consumers.begin()); c != consumers.end(); ++c) {
+                const auto clone = n->clone_with_new_inputs(n->input_values());
+                ngraph::copy_runtime_info(n, clone);
+                stage[clone] = c->first;
+                for (auto& consumer : c->second) {
+                    consumer.replace_source_output(clone->output(consumer.get_source_output().get_index()));
+                }
+            }
+        }
+    }
+
+    for (const auto& s : stage) {
+        set_stage(s.first, s.second);
+    }
+    return true;
+}
@@ -7,10 +7,12 @@
 #include "snippets/remarks.hpp"
 
 #include "snippets/pass/assign_registers.hpp"
+#include "snippets/pass/assign_reduction_stages.hpp"
 #include "snippets/snippets_isa.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 
+#include <algorithm>
 #include <iterator>
 
 bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr<ov::Model>& f) {
@@ -18,7 +20,8 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::AssignRegisters")
     int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
     using Reg = size_t;
-    auto ops = f->get_ordered_ops();
+    // the stages are emitted one after another, so the statements are ordered by stages
+    auto ops = GetStageOrderedOps(f);
     decltype(ops) stmts;
     std::copy_if(ops.begin(), ops.end(), std::back_inserter(stmts), [](decltype(ops[0]) op) {
         return !(std::dynamic_pointer_cast<opset1::Parameter>(op) || std::dynamic_pointer_cast<opset1::Result>(op));
@@ -78,19 +81,12 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         }
     }
 
-    struct by_starting {
-        auto operator()(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) const -> bool {
-            return lhs.first < rhs.first|| (lhs.first == rhs.first && lhs.second < rhs.second);
-        }
-    };
-
-    struct by_ending {
-        auto operator()(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) const -> bool {
-            return lhs.second < rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
-        }
+    struct live_interval {
+        int start;
+        int end;
+        Reg reg;
     };
-
-    std::set<std::pair<int, int>, by_starting> live_intervals;
+    std::vector<live_interval> live_intervals;
 
     std::reverse(lifeIn.begin(), lifeIn.end());
     auto find_last_use = [lifeIn](int i) -> int {
@@ -105,32 +101,56 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
     };
 
     for (size_t i = 0; i < stmts.size(); i++) {
-        live_intervals.insert(std::make_pair(i, find_last_use(i)));
+        live_intervals.push_back({static_cast<int>(i), find_last_use(i), i});
+    }
+
+    // Every reduction stage is a loop over the innermost dimension, so a reduction accumulator must survive the whole loop
+    // it is accumulated in and the whole loops of the stages it is consumed in
+    std::map<size_t, std::pair<int, int>> stage_bounds;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        const auto stage = GetReductionStage(stmts[i]);
+        if (!stage_bounds.count(stage))
+            stage_bounds[stage].first = static_cast<int>(i);
+        stage_bounds[stage].second = static_cast<int>(i);
+    }
+    for (size_t i = 0; i < stmts.size(); i++) {
+        if (!ov::is_type<snippets::op::Reduce>(stmts[i]))
+            continue;
+        size_t last_stage = GetReductionStage(stmts[i]);
+        for (const auto& consumer : stmts[i]->get_users())
+            last_stage = std::max(last_stage, GetReductionStage(consumer));
+        live_intervals[i].start = stage_bounds[GetReductionStage(stmts[i])].first;
+        live_intervals[i].end = std::max(live_intervals[i].end, stage_bounds[last_stage].second);
     }
 
+    std::sort(live_intervals.begin(), live_intervals.end(), [](const live_interval& lhs, const live_interval& rhs) {
+        return lhs.start < rhs.start || (lhs.start == rhs.start && lhs.end < rhs.end);
+    });
+
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
-    std::multiset<std::pair<int, int>, by_ending> active;
+    // active intervals ordered by ending
+    std::multiset<std::pair<int, Reg>> active;
     std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
     for (int i = 0; i < 16; i++) bank.push(16-1-i);
 
-    for (auto interval : live_intervals) {
+    for (const auto& interval : live_intervals) {
         // check expired
         while (!active.empty()) {
-            auto x = *active.begin();
-            if (x.second >= interval.first) {
+            auto x = active.begin();
+            if (x->first >= interval.start) {
                 break;
             }
+            bank.push(register_map[x->second]);
             active.erase(x);
-            bank.push(register_map[x.first]);
         }
         // allocate
         if (active.size() == 16) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
-            register_map[interval.first] = bank.top();
+            register_map[interval.reg] = bank.top();
             bank.pop();
-            active.insert(interval);
+            active.insert(std::make_pair(interval.end, interval.reg));
         }
     }
 
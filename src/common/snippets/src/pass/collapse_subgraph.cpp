@@ -104,6 +104,18 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
     return is_layout_oblivious_unary(n) || is_layout_oblivious_binary(n);
 }
 
+// Reductions over the innermost dimension are executed inside the tile, their consumers are executed in the following stages
+auto is_supported_reduction(const std::shared_ptr<const Node> &n) -> bool {
+    if (!ov::is_type<opset1::ReduceSum>(n) && !ov::is_type<opset1::ReduceMax>(n) && !ov::is_type<opset1::ReduceMean>(n))
+        return false;
+    const auto reduction = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(n);
+    const auto& shape = n->get_input_partial_shape(0);
+    if (!reduction->get_keep_dims() || !reduction->reduction_axes_constant() || shape.is_dynamic() || shape.rank().get_length() == 0)
+        return false;
+    const auto rank = static_cast<size_t>(shape.rank().get_length());
+    return shape[rank - 1].get_length() > 1 && reduction->get_reduction_axes() == AxisSet{rank - 1};
+}
+
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
         return t.get_element_type() == ngraph::element::f32 &&
@@ -119,7 +131,9 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // reduction axes are not passed to the body as a tensor
+    const auto data_inputs_end = is_supported_reduction(n) ? inputs.begin() + 1 : inputs.end();
+    return std::all_of(inputs.begin(), data_inputs_end, [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -167,10 +181,20 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
         }
     }
 }
+// Canonicalization may prepend the body shapes with ones, so the reduced axis is counted from the end.
+// Only the body ops are changed, the original node is left intact if it isn't tokenized.
+auto set_last_reduction_axes(const std::shared_ptr<ov::Model> &body) -> void {
+    for (const auto &op : body->get_ops()) {
+        if (is_supported_reduction(op)) {
+            const auto axis = std::make_shared<opset1::Constant>(element::i64, Shape{1}, std::vector<int64_t>{-1});
+            op->input(1).replace_source_output(axis);
+        }
+    }
+}
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || is_supported_reduction(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -228,7 +252,6 @@ TokenizeSnippets::TokenizeSnippets() {
         if (transformation_callback(node)) {
             return false;
         }
-
         remark(1) << "Match root: " << node->get_friendly_name() << " " << node << std::endl;
 
         const auto getFusedNames = [](const std::shared_ptr<Node>& n) -> std::string {
@@ -242,6 +265,7 @@ TokenizeSnippets::TokenizeSnippets() {
 
         auto create_single_node_subgraph = [&](const std::shared_ptr<Node> &node) {
             auto subgraph = op::Subgraph::wrap_node_as_subgraph(node);
+            set_last_reduction_axes(subgraph->get_body());
             subgraph->get_rt_info()["originalLayersNames"] = getFusedNames(node) + node->get_friendly_name();
             ngraph::replace_node(node, subgraph);
             update_out_tensor_name(subgraph);
@@ -501,6 +525,7 @@ TokenizeSnippets::TokenizeSnippets() {
 
         if (outputs_are_not_broadcastable(subgraph))
             return abort_with_strategy("New subgraph is created due to outputs of a subgraph not broadcastable.");
+        set_last_reduction_axes(subgraph->get_body());
 
         for (size_t i = 0; i < subgraph->get_output_size(); ++i) {
             for (auto target_input : subgraph_result_inputs[i]) {
@@ -0,0 +1,41 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/convert_reductions.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+
+ngraph::snippets::pass::ConvertReductions::ConvertReductions() {
+    MATCHER_SCOPE(ConvertReductions);
+    auto reduction = ngraph::pattern::wrap_type<opset1::ReduceSum, opset1::ReduceMax, opset1::ReduceMean>();
+    ngraph::graph_rewrite_callback callback = [this](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ConvertReductions")
+        auto root = m.get_match_root();
+        auto reduction = ov::as_type_ptr<ov::op::util::ArithmeticReductionKeepDims>(root);
+        const auto& shape = root->get_input_shape(0);
+        NGRAPH_CHECK(reduction->get_keep_dims() && reduction->reduction_axes_constant() && !shape.empty() &&
+                     reduction->get_reduction_axes() == AxisSet{shape.size() - 1},
+                     "Snippets support only reductions over the innermost dimension with kept dims, got ", root->get_friendly_name());
+
+        const auto kind = ov::is_type<opset1::ReduceMax>(root) ? snippets::op::Reduce::Kind::Max : snippets::op::Reduce::Kind::Sum;
+        std::shared_ptr<Node> replacement = std::make_shared<snippets::op::Reduce>(root->input_value(0), kind);
+        NodeVector new_ops{replacement};
+        if (ov::is_type<opset1::ReduceMean>(root)) {
+            auto scale = std::make_shared<snippets::op::Scalar>(element::f32, Shape{1}, 1.f / static_cast<float>(shape.back()));
+            replacement = std::make_shared<opset1::Multiply>(replacement, scale);
+            new_ops.push_back(scale);
+            new_ops.push_back(replacement);
+        }
+        replacement->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, new_ops);
+        ngraph::replace_node(root, replacement);
+
+        return true;
+    };
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(reduction), callback);
+}
@@ -44,3 +44,20 @@ ngraph::snippets::pass::ReplaceStoresWithScalarStores::ReplaceStoresWithScalarSt
             return true;
         });
 }
+
+ngraph::snippets::pass::ReplaceReducesWithScalarReduces::ReplaceReducesWithScalarReduces() {
+    MATCHER_SCOPE(ReplaceReducesWithScalarReduces);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::snippets::op::Reduce>()),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ReplaceReducesWithScalarReduces_callback")
+            auto root = ov::as_type_ptr<ngraph::snippets::op::Reduce>(m.get_match_root());
+            if (!root || ov::is_type<ngraph::snippets::op::ScalarReduce>(root) || transformation_callback(root))
+                return false;
+            auto reduce = std::make_shared<ngraph::snippets::op::ScalarReduce> (root->input_value(0), root->get_kind());
+            reduce->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, reduce);
+            ngraph::replace_node(root, reduce);
+            return true;
+        });
+}
@@ -39,6 +39,13 @@ TEST_F(CollapseSubgraphTests, smoke_Snippets_AvoidLoopEltwise) {
     run();
 }
 
+TEST_F(CollapseSubgraphTests, smoke_Snippets_SoftmaxReductions) {
+    const auto &f = SoftmaxSinhFunction(std::vector<Shape> {{2, 3, 17}});
+    function = f.getOriginal();
+    function_ref = f.getReference();
+    run();
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
@@ -4,22 +4,64 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "ngraph/opsets/opset.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/runtime_attribute.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/pass/serialize.hpp"
 
 namespace ov {
+
+/**
+ * @brief The digests of the Constants data computed by the Hash pass. The memo is owned by the caller (e.g. the model
+ * cache of the Core), so the hashed model is not modified. Only the digests of the data allocated by the Constants are
+ * kept, such data is not changed after the construction. The digest is used while the Constant is alive and refers the
+ * same buffer. The data shared with the creator of the Constant (see ov::op::v0::Constant::is_data_shared) may be
+ * changed in place, so it is hashed every time. The object is thread safe.
+ */
+class NGRAPH_API ConstantDigestCache {
+public:
+    bool find(const std::shared_ptr<ov::op::v0::Constant>& constant, uint64_t& digest) const;
+
+    void insert(const std::shared_ptr<ov::op::v0::Constant>& constant, uint64_t digest);
+
+private:
+    struct Entry {
+        std::weak_ptr<ov::Node> node;
+        const void* data;
+        size_t size;
+        uint64_t digest;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<const ov::Node*, Entry> m_entries;
+    size_t m_cleanup_threshold = 64;
+};
+
 namespace pass {
 
 /**
  * @brief Hash transformation calculates hash value for ov::Model
+ *
+ * The structure of the model is hashed separately from the constants data. The data is split to chunks, which are
+ * hashed independently. If the memo of the digests is passed (see ov::ConstantDigestCache), the repeated hashing of
+ * the same model doesn't read the data allocated by the constants again.
  */
 class NGRAPH_API Hash : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("HashPass");
 
+    /**
+     * @brief Runs the body for the indices [0, count), the calls may be done in parallel
+     */
+    using ParallelFor = std::function<void(size_t count, const std::function<void(size_t)>& body)>;
+
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
     /**
@@ -30,8 +72,21 @@ public:
      */
     Hash(uint64_t& output_hash_value);
 
+    /**
+     * @brief Hash pass constructor
+     *
+     * @param output_hash_value Reference to output value
+     * @param parallel_for The executor of the constants data chunks hashing
+     * @param digests The memo of the constants digests, may be shared by the passes running concurrently
+     */
+    Hash(uint64_t& output_hash_value,
+         ParallelFor parallel_for,
+         std::shared_ptr<ConstantDigestCache> digests = nullptr);
+
 private:
     uint64_t& m_hash;
+    ParallelFor m_parallel_for;
+    std::shared_ptr<ConstantDigestCache> m_digests;
 };
 
 }  // namespace pass
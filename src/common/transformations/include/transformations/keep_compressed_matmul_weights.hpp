@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API KeepCompressedMatMulWeights;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief Keeps the compressed MatMul weights compressed: the decompression subgraph
+ * Constant -> Convert [-> Subtract(zero point)] [-> Multiply(scale)] on the MatMul weights is excluded
+ * from ConstantFolding and the compressed Constant keeps its precision in ConvertPrecision,
+ * so the plugin can decompress the weights on the fly.
+ */
+class ov::pass::KeepCompressedMatMulWeights : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("KeepCompressedMatMulWeights", "0");
+    explicit KeepCompressedMatMulWeights(
+        const element::TypeVector& compressed_precisions = {element::f16, element::i8, element::u8, element::i4, element::u4});
+};
@@ -16,6 +16,7 @@
 #include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/rt_info/disable_fp16_compression.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
 #include <transformations/rt_info/nms_selected_indices.hpp>
 #include <transformations/rt_info/old_api_map_element_type_attribute.hpp>
 #include <transformations/rt_info/old_api_map_order_attribute.hpp>
@@ -16,6 +16,7 @@
 
 #include "itt.hpp"
 #include "ngraph_ops/type_relaxed.hpp"
+#include "transformations/rt_info/keep_const_precision.hpp"
 
 using namespace ngraph;
 
@@ -129,6 +130,9 @@ bool convert_precision(pass::PassBase& pass,
                 // Function object
                 auto it = const_to_internal_output.find(node.get());
                 if (it != const_to_internal_output.end()) {
+                    // The compressed Constants are kept as is, their consumers decompress them
+                    if (ov::is_keep_const_precision(node))
+                        return false;
                     return fuse_type_to_constant(node, to, it->second);
                 }
 
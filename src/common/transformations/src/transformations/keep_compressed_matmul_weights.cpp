@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/keep_compressed_matmul_weights.hpp"
+
+#include "itt.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/rt_info/disable_constant_folding.hpp"
+#include "transformations/rt_info/keep_const_precision.hpp"
+
+ov::pass::KeepCompressedMatMulWeights::KeepCompressedMatMulWeights(const element::TypeVector& compressed_precisions) {
+    MATCHER_SCOPE(KeepCompressedMatMulWeights);
+    // the compressed Constant is the only input of the decompression subgraph, so its precision can be kept
+    auto is_compressed_weights = [compressed_precisions](Output<Node> output) {
+        return pattern::type_matches_any(compressed_precisions)(output) && pattern::consumers_count(1)(output);
+    };
+    auto weights = pattern::wrap_type<opset8::Constant>(is_compressed_weights);
+    auto convert = pattern::wrap_type<opset8::Convert>({weights}, pattern::consumers_count(1));
+
+    auto zero_point = pattern::wrap_type<opset8::Constant>();
+    auto zero_point_convert = pattern::wrap_type<opset8::Convert>({zero_point});
+    auto zero_point_or_convert = std::make_shared<pattern::op::Or>(OutputVector{zero_point, zero_point_convert});
+    auto subtract = pattern::wrap_type<opset8::Subtract>({convert, zero_point_or_convert}, pattern::consumers_count(1));
+    auto subtract_or_convert = std::make_shared<pattern::op::Or>(OutputVector{convert, subtract});
+
+    auto scale = pattern::wrap_type<opset8::Constant>();
+    auto multiply = pattern::wrap_type<opset8::Multiply>({subtract_or_convert, scale}, pattern::consumers_count(1));
+    auto decompression = std::make_shared<pattern::op::Or>(OutputVector{subtract_or_convert, multiply});
+
+    auto matmul = pattern::wrap_type<opset8::MatMul>({pattern::any_input(), decompression});
+
+    ov::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto& convert_node = pattern_map.at(convert).get_node_shared_ptr();
+        if (!convert_node->get_output_element_type(0).is_real())
+            return false;
+
+        disable_constant_folding(convert_node);
+        enable_keep_const_precision(pattern_map.at(weights).get_node_shared_ptr());
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(matmul, matcher_name);
+    this->register_matcher(m, callback);
+}
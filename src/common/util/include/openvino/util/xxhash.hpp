@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief 64-bit non-cryptographic hash of the data (xxHash64 algorithm). Four independent lanes consume 8-byte words,
+ * so the multiplications of the lanes are pipelined. The result is the same on all the platforms.
+ * @param data The data to hash
+ * @param size The size of the data in bytes
+ * @param seed The initial value of the hash
+ */
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace util
+}  // namespace ov
@@ -162,6 +162,7 @@ public:
         : m_element_type(type),
           m_shape(shape) {
         m_data = data;
+        m_shared_data = true;
         constructor_validate_and_infer_types();
     }
 
@@ -371,6 +372,13 @@ public:
         return static_cast<const typename element_type_traits<ET>::value_type*>(get_data_ptr());
     }
 
+    /// \brief Returns true if the data is kept in the memory shared with the creator of the constant (e.g. the
+    /// weights file mapped to the memory or the tensor of the user), the owner of the memory may change it.
+    /// The data allocated by the constant is not changed after the construction.
+    bool is_data_shared() const {
+        return m_shared_data;
+    }
+
     bool get_all_data_elements_bitwise_identical() const {
         if (!m_all_elements_bitwise_identical_checked) {
             update_identical_flags(true, are_all_data_elements_bitwise_identical());
@@ -716,6 +724,7 @@ private:
     element::Type m_element_type;
     Shape m_shape{};
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_data;
+    bool m_shared_data = false;
     mutable std::atomic_bool m_all_elements_bitwise_identical{false};
     mutable std::atomic_bool m_all_elements_bitwise_identical_checked{false};
     bool m_alloc_buffer_on_visit_attributes = true;
@@ -14,11 +14,21 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *        The nodes are processed by the topological levels, the nodes of one level with constant inputs
+ *        are evaluated in parallel when the PassConfig provides the parallel_for executor. The nodes are
+ *        released as soon as they are processed, so the folded constants are destroyed once their last
+ *        consumer is folded.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+
+    /// \param max_parallel_folding_size The limit of the bytes of the constants evaluated in parallel and
+    /// not yet inserted into the model. The node which exceeds the limit alone is evaluated separately.
+    explicit ConstantFolding(size_t max_parallel_folding_size = 256 * 1024 * 1024)
+        : m_max_parallel_folding_size(max_parallel_folding_size) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
 protected:
@@ -26,6 +36,14 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& f);
+    /// \brief Replaces the node outputs with the constants it was folded to
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+    /// \brief Folds the nodes with constant inputs in parallel in the batches limited by the
+    /// max_parallel_folding_size, the nodes are released once they are replaced
+    bool fold_in_parallel(std::vector<std::shared_ptr<Node>>& nodes);
+
+private:
+    size_t m_max_parallel_folding_size;
 };
 
 /**
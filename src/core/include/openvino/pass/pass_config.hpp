@@ -18,6 +18,8 @@ namespace ov {
 namespace pass {
 using param_callback = std::function<bool(const std::shared_ptr<const ::ov::Node>)>;
 using param_callback_map = std::map<ov::DiscreteTypeInfo, param_callback>;
+/// \brief Runs the body for the indices [0, count), the calls may be done in parallel
+using parallel_for_callback = std::function<void(size_t count, const std::function<void(size_t)>& body)>;
 
 /// \brief Class representing a transformations config that is used for disabling/enabling
 /// transformations registered inside pass::Manager and also allows to set callback for all
@@ -196,6 +198,18 @@ public:
 
     void add_disabled_passes(const PassConfig& rhs);
 
+    /// \brief Set the executor the transformations may use to process the model in parallel,
+    /// e.g. GraphRewrite matches the patterns for all the nodes in advance with it
+    /// \param parallel_for The executor, the empty one means the serial execution
+    void set_parallel_for(const parallel_for_callback& parallel_for) {
+        m_parallel_for = parallel_for;
+    }
+
+    /// \brief Get the executor set by set_parallel_for()
+    const parallel_for_callback& get_parallel_for() const {
+        return m_parallel_for;
+    }
+
 private:
     param_callback m_callback = [](const std::shared_ptr<const ::ov::Node>&) {
         return false;
@@ -203,6 +217,7 @@ private:
     param_callback_map m_callback_map;
     std::unordered_set<DiscreteTypeInfo> m_disabled;
     std::unordered_set<DiscreteTypeInfo> m_enabled;
+    parallel_for_callback m_parallel_for;
 };
 }  // namespace pass
 }  // namespace ov
@@ -46,13 +46,7 @@ public:
     }
 
     explicit Label(const element::Type& type = element::dynamic, const PartialShape& s = PartialShape::dynamic())
-        : Label(
-              type,
-              s,
-              [](const Output<Node>&) {
-                  return true;
-              },
-              OutputVector()) {}
+        : Label(type, s, nullptr, OutputVector()) {}
 
     Label(const element::Type& type, const PartialShape& s, ValuePredicate pred)
         : Label(type, s, pred, OutputVector{}) {}
@@ -83,13 +77,7 @@ public:
     Label(const Output<Node>& value, const NodePredicate pred)
         : Label(value.get_element_type(), value.get_partial_shape(), as_value_predicate(pred), OutputVector{}) {}
     Label(const Output<Node>& value)
-        : Label(
-              value.get_element_type(),
-              value.get_partial_shape(),
-              [](const Output<Node>&) {
-                  return true;
-              },
-              OutputVector{}) {}
+        : Label(value.get_element_type(), value.get_partial_shape(), nullptr, OutputVector{}) {}
     Label(const Output<Node>& node, const NodePredicate pred, const NodeVector& wrapped_values)
         : Label(node.get_element_type(),
                 node.get_partial_shape(),
@@ -71,7 +71,10 @@ class OPENVINO_API Pattern : public Node {
 public:
     /// \brief \p a base class for \sa Skip and \sa Label
     ///
-    Pattern(const OutputVector& patterns, ValuePredicate pred) : Node(patterns), m_predicate(pred) {
+    Pattern(const OutputVector& patterns, ValuePredicate pred)
+        : Node(patterns),
+          m_predicate(pred),
+          m_has_predicate(static_cast<bool>(pred)) {
         if (!m_predicate) {
             m_predicate = [](const Output<Node>&) {
                 return true;
@@ -87,8 +90,14 @@ public:
 
     ValuePredicate get_predicate() const;
 
+    /// \brief Returns false if the pattern is created without the predicate, so it accepts any value
+    bool has_predicate() const {
+        return m_has_predicate;
+    }
+
 protected:
     ValuePredicate m_predicate;
+    bool m_has_predicate;
 };
 }  // namespace op
 }  // namespace pattern
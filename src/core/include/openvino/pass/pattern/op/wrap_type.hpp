@@ -19,10 +19,7 @@ public:
 
     explicit WrapType(
         NodeTypeInfo wrapped_type,
-        const ValuePredicate& pred =
-            [](const Output<Node>& output) {
-                return true;
-            },
+        const ValuePredicate& pred = nullptr,
         const OutputVector& input_values = {})
         : Pattern(input_values, pred),
           m_wrapped_types({wrapped_type}) {
@@ -31,10 +28,7 @@ public:
 
     explicit WrapType(
         std::vector<NodeTypeInfo> wrapped_types,
-        const ValuePredicate& pred =
-            [](const Output<Node>& output) {
-                return true;
-            },
+        const ValuePredicate& pred = nullptr,
         const OutputVector& input_values = {})
         : Pattern(input_values, pred),
           m_wrapped_types(std::move(wrapped_types)) {
@@ -80,9 +74,7 @@ std::shared_ptr<Node> wrap_type(const OutputVector& inputs, const pattern::op::V
 
 template <class... Args>
 std::shared_ptr<Node> wrap_type(const OutputVector& inputs = {}) {
-    return wrap_type<Args...>(inputs, [](const Output<Node>& output) {
-        return true;
-    });
+    return wrap_type<Args...>(inputs, nullptr);
 }
 
 template <class... Args>
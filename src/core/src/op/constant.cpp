@@ -44,6 +44,7 @@ ov::op::v0::Constant::Constant(const shared_ptr<ngraph::runtime::Tensor>& tensor
             static_cast<char*>(hostTensor->get_data_ptr()),
             tensor->get_size_in_bytes(),
             tensor);
+        m_shared_data = true;
     } else {
         constructor_validate_and_infer_types();
         allocate_buffer(false);
@@ -197,6 +198,7 @@ ov::op::v0::Constant::Constant(bool memset_allocation, const element::Type& type
 
 void ov::op::v0::Constant::allocate_buffer(bool memset_allocation) {
     m_data = make_shared<ngraph::runtime::AlignedBuffer>(mem_size(), host_alignment());
+    m_shared_data = false;
     if (memset_allocation) {
         std::memset(m_data->get_ptr(), 0, m_data->size());
     }
@@ -212,6 +214,7 @@ ov::op::v0::Constant::Constant(const Constant& other) {
     m_element_type = other.m_element_type;
     m_shape = other.m_shape;
     m_data = other.m_data;
+    m_shared_data = other.m_shared_data;
     update_identical_flags(other.m_all_elements_bitwise_identical_checked, other.m_all_elements_bitwise_identical);
     constructor_validate_and_infer_types();
 }
@@ -223,6 +226,7 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
     m_element_type = other.m_element_type;
     m_shape = new_shape;
     m_data = other.m_data;
+    m_shared_data = other.m_shared_data;
     update_identical_flags(other.m_all_elements_bitwise_identical_checked, other.m_all_elements_bitwise_identical);
     constructor_validate_and_infer_types();
 }
@@ -4,7 +4,9 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <limits>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/opsets/opset1.hpp"
@@ -14,52 +16,154 @@
 
 using namespace std;
 
+namespace {
+// The nodes grouped by the topological levels, the nodes of one level don't depend on each other
+std::vector<std::vector<std::shared_ptr<ov::Node>>> get_topological_levels(const std::shared_ptr<ov::Model>& f) {
+    std::vector<std::vector<std::shared_ptr<ov::Node>>> levels;
+    std::unordered_map<const ov::Node*, size_t> node_levels;
+    auto level_after = [&](const ov::Node* node, size_t level) {
+        const auto it = node_levels.find(node);
+        return it == node_levels.end() ? level : std::max(level, it->second + 1);
+    };
+    for (auto& node : f->get_ordered_ops()) {
+        size_t level = 0;
+        for (const auto& input : node->input_values())
+            level = level_after(input.get_node(), level);
+        for (const auto& dependency : node->get_control_dependencies())
+            level = level_after(dependency.get(), level);
+        node_levels[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(std::move(node));
+    }
+    return levels;
+}
+
+// The nodes which are folded in parallel: the ones with constant inputs which don't fold the sub-graphs
+bool is_foldable_in_parallel(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::pass::constant_folding_is_disabled(node) ||
+        ov::is_type<ngraph::op::util::MultiSubGraphOp>(node))
+        return false;
+    const auto inputs = node->input_values();
+    return std::all_of(inputs.cbegin(), inputs.cend(), [](const ov::Output<ov::Node>& input) {
+        return ov::is_type<ngraph::op::Constant>(input.get_node());
+    });
+}
+
+// The bytes of the constants the node is folded to, the maximum for the dynamic outputs
+size_t folded_size(const ov::Node* node) {
+    size_t size = 0;
+    for (const auto& output : node->outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.is_dynamic())
+            return std::numeric_limits<size_t>::max();
+        size += (ov::shape_size(shape.get_shape()) * output.get_element_type().bitwidth() + 7) / 8;
+    }
+    return size;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops()) {
-        if (rewritten) {
-            node->validate_and_infer_types();
-        }
+    const auto& parallel_for = get_pass_config()->get_parallel_for();
+    // the nodes of the current level with constant inputs, they are folded in parallel after the level is validated
+    std::vector<std::shared_ptr<Node>> to_fold;
+    for (auto& level : get_topological_levels(f)) {
+        for (auto& node : level) {
+            if (rewritten) {
+                node->validate_and_infer_types();
+            }
 
-        OutputVector replacements(node->get_output_size());
-
-        // We have to check node for DisableConstantFolding because operations can override constant_folding
-        // method, so we can't always rely on attribute check inside default node->constant_fold method
-        if (node->get_rt_info().count(DisableConstantFolding::get_type_info_static()) == 0 &&
-            node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+            if (parallel_for && is_foldable_in_parallel(node)) {
+                to_fold.push_back(std::move(node));
+                continue;
+            }
 
-                    rewritten = true;
+            OutputVector replacements(node->get_output_size());
+
+            // We have to check node for DisableConstantFolding because operations can override constant_folding
+            // method, so we can't always rely on attribute check inside default node->constant_fold method
+            if (node->get_rt_info().count(DisableConstantFolding::get_type_info_static()) == 0 &&
+                node->constant_fold(replacements, node->input_values())) {
+                rewritten |= replace_with_folded(node, replacements);
+            } else {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten |= run_on_model(sub_graph_node->get_function(sub_graph_ind));
+                    }
                 }
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(sub_graph_ind));
-                }
+            // release the node, so its folded inputs are destroyed when it was their last consumer
+            node.reset();
+        }
+        rewritten |= fold_in_parallel(to_fold);
+    }
+
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements) {
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            if (replacements.size() == 1) {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            } else {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                     std::to_string(i));
             }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
         }
     }
+    return rewritten;
+}
 
+bool ov::pass::ConstantFolding::fold_in_parallel(std::vector<std::shared_ptr<Node>>& nodes) {
+    const auto& parallel_for = get_pass_config()->get_parallel_for();
+    bool rewritten = false;
+    std::vector<OutputVector> replacements;
+    std::vector<char> folded;
+    for (size_t begin = 0, end = 0; begin < nodes.size(); begin = end) {
+        // the batch is limited by the size of the folded constants, but contains one node at least
+        size_t batch_size = folded_size(nodes[begin].get());
+        for (end = begin + 1; end < nodes.size(); ++end) {
+            const auto size = folded_size(nodes[end].get());
+            if (batch_size > m_max_parallel_folding_size || size > m_max_parallel_folding_size - batch_size)
+                break;
+            batch_size += size;
+        }
+
+        replacements.assign(end - begin, OutputVector{});
+        folded.assign(end - begin, false);
+        parallel_for(end - begin, [&](size_t i) {
+            const auto& node = nodes[begin + i];
+            replacements[i].resize(node->get_output_size());
+            folded[i] = node->constant_fold(replacements[i], node->input_values());
+        });
+
+        // the replacements are made in the order of the nodes to keep the model deterministic
+        for (size_t i = begin; i < end; ++i) {
+            if (folded[i - begin])
+                rewritten |= replace_with_folded(nodes[i], replacements[i - begin]);
+            replacements[i - begin].clear();
+            nodes[i].reset();
+        }
+    }
+    nodes.clear();
     return rewritten;
 }
 
@@ -5,10 +5,14 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <iomanip>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -16,6 +20,8 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/pass/pattern/op/branch.hpp"
+#include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -48,7 +54,18 @@
  * In this case, you need to register nodes in MatcherPass manually using register_new_node method.
  * GraphRewrite will automatically add this nodes in the beginning of execution queue.
  * If MatcherPass register more than one node make sure that this nodes are registered in
- * topological order. */
+ * topological order.
+ *
+ * Parallel matching:
+ * When the PassConfig provides the parallel_for executor, the patterns without the predicates are matched
+ * against all the nodes in parallel before the rewriting. Such patterns observe only the types, the producers,
+ * the output types and shapes of the nodes, the predicates may observe anything else (consumers, runtime info,
+ * attributes), so the matchers with the predicates are never skipped. Then the nodes are processed in the same
+ * order as above, but the matchers without the predicates are applied to the node only if their patterns matched
+ * it. As the matchers rewrite the graph, the result of the matching done in advance is reused for the node only
+ * while the node and its producers up to the depth of the patterns keep the type, the inputs, the output types,
+ * shapes and consumers they had, otherwise all the matchers are applied to the node as usual. The matcher passes
+ * are expected to apply their callbacks only when their patterns match. */
 
 namespace ov {
 namespace pass {
@@ -57,6 +74,94 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+bool profile_enabled() {
+    static const bool enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    return enabled;
+}
+
+// the models with fewer nodes are not matched in advance as it doesn't pay off
+constexpr size_t min_nodes_to_match_in_parallel = 1024;
+// the number of the nodes matched by one parallel task
+constexpr size_t nodes_per_matching_task = 256;
+
+void hash_combine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// The hash of the node state the patterns observe: the type, the producers, the output types, shapes and consumers
+size_t node_signature(const Node* node) {
+    size_t seed = std::hash<const void*>()(&node->get_type_info());
+    for (size_t i = 0; i < node->get_input_size(); i++) {
+        const auto source = node->input_value(i);
+        hash_combine(seed, std::hash<const void*>()(source.get_node()));
+        hash_combine(seed, source.get_index());
+    }
+    for (size_t i = 0; i < node->get_output_size(); i++) {
+        hash_combine(seed, node->get_output_element_type(i).hash());
+        const auto& shape = node->get_output_partial_shape(i);
+        if (shape.rank().is_static()) {
+            for (const auto& dim : shape) {
+                hash_combine(seed, static_cast<size_t>(dim.get_min_length()));
+                hash_combine(seed, static_cast<size_t>(dim.get_max_length()));
+            }
+        } else {
+            hash_combine(seed, ~static_cast<size_t>(0));
+        }
+        hash_combine(seed, node->get_output_target_inputs(i).size());
+    }
+    hash_combine(seed, node->get_rt_info().size());
+    return seed;
+}
+
+// The number of the producers levels the pattern observes, -1 if the pattern is not bounded (recurrent)
+int64_t pattern_depth(const Output<Node>& pattern, std::unordered_map<const Node*, int64_t>& depths) {
+    const auto node = pattern.get_node();
+    const auto it = depths.find(node);
+    if (it != depths.end())
+        return it->second;
+    int64_t depth = 0;
+    if (ov::is_type<pattern::op::Branch>(node)) {
+        depth = -1;
+    } else {
+        for (const auto& input : node->input_values()) {
+            const auto input_depth = pattern_depth(input, depths);
+            if (input_depth < 0) {
+                depth = -1;
+                break;
+            }
+            depth = std::max(depth, input_depth + 1);
+        }
+    }
+    depths[node] = depth;
+    return depth;
+}
+
+// True if the pattern has no predicates, so it observes only the node state included to the signature above
+bool is_predicate_free(const Output<Node>& pattern, std::unordered_set<const Node*>& visited) {
+    const auto node = pattern.get_node();
+    if (!visited.insert(node).second)
+        return true;
+    if (const auto pattern_node = dynamic_cast<const pattern::op::Pattern*>(node)) {
+        if (pattern_node->has_predicate())
+            return false;
+    }
+    for (const auto& input : node->input_values()) {
+        if (!is_predicate_free(input, visited))
+            return false;
+    }
+    return true;
+}
+
+// The matchers of the patterns matched against the node in advance and the node state they observed
+struct SpeculativeMatch {
+    // the node the match belongs to, the address of the expired node may be reused by the new one
+    std::weak_ptr<Node> node;
+    size_t signature = 0;
+    // the matchers to apply: the matchers whose patterns matched and the matchers with the predicates
+    std::vector<size_t> matchers;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -128,6 +233,138 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // including ones triggered by parent type info.
     }
 
+    // collects the matchers to run for the node including ones triggered by the node parent types,
+    // in order of the registration
+    auto collect_matchers = [&](const Node* node, std::vector<size_t>& matchers_to_run) {
+        matchers_to_run.clear();
+        const DiscreteTypeInfo* node_type_info = &node->get_type_info();
+        while (node_type_info) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matchers_to_run.insert(matchers_to_run.end(), matchers->second.begin(), matchers->second.end());
+            }
+            node_type_info = node_type_info->parent;
+        }
+        std::sort(matchers_to_run.begin(), matchers_to_run.end());
+    };
+
+    const bool profile = profile_enabled();
+    std::chrono::steady_clock::duration matching_time{0};
+    std::unordered_map<const MatcherPass*, std::pair<std::chrono::steady_clock::duration, size_t>> matcher_stats;
+
+    // Match the patterns against all the nodes in parallel in advance (see the algorithm description above)
+    std::unordered_map<const Node*, SpeculativeMatch> speculative_matches;
+    int64_t observed_depth = 0;
+    const auto& parallel_for = pass_config->get_parallel_for();
+    if (parallel_for && all_roots_has_type && !m_enable_shape_inference &&
+        nodes_to_run.size() >= min_nodes_to_match_in_parallel) {
+        std::unordered_map<const Node*, int64_t> depths;
+        std::unordered_set<const Node*> visited_patterns;
+        // the patterns matched in advance, null for the matchers with the predicates
+        std::vector<std::shared_ptr<pattern::Matcher>> patterns(m_matchers.size());
+        bool any_pattern = false;
+        for (const auto& matchers : type_to_matcher) {
+            for (auto matcher_index : matchers.second) {
+                auto matcher = m_matchers[matcher_index]->get_matcher();
+                const auto depth = pattern_depth(matcher->get_pattern_value(), depths);
+                // the derived matchers and the recurrent patterns are matched only at the rewriting
+                if (typeid(*matcher) != typeid(pattern::Matcher) || depth < 0) {
+                    observed_depth = -1;
+                    break;
+                }
+                visited_patterns.clear();
+                if (!is_predicate_free(matcher->get_pattern_value(), visited_patterns))
+                    continue;
+                observed_depth = std::max(observed_depth, depth);
+                patterns[matcher_index] = matcher;
+                any_pattern = true;
+            }
+            if (observed_depth < 0)
+                break;
+        }
+        if (observed_depth >= 0 && any_pattern) {
+            const auto start = std::chrono::steady_clock::now();
+            std::vector<std::shared_ptr<Node>> matched_nodes;
+            matched_nodes.reserve(nodes_to_run.size());
+            for (const auto& weak_node : nodes_to_run) {
+                if (auto node = weak_node.lock())
+                    matched_nodes.push_back(node);
+            }
+            std::vector<SpeculativeMatch> matches(matched_nodes.size());
+            const size_t num_tasks = (matched_nodes.size() + nodes_per_matching_task - 1) / nodes_per_matching_task;
+            parallel_for(num_tasks, [&](size_t task) {
+                // the matchers keep the state of the matching, so each task matches with the own matchers
+                std::vector<std::unique_ptr<pattern::Matcher>> matchers(patterns.size());
+                std::vector<size_t> candidates;
+                const size_t end = std::min(matched_nodes.size(), (task + 1) * nodes_per_matching_task);
+                for (size_t i = task * nodes_per_matching_task; i < end; i++) {
+                    const auto& node = matched_nodes[i];
+                    matches[i].node = node;
+                    matches[i].signature = node_signature(node.get());
+                    collect_matchers(node.get(), candidates);
+                    for (auto matcher_index : candidates) {
+                        const auto& pattern = patterns[matcher_index];
+                        if (!pattern) {
+                            matches[i].matchers.push_back(matcher_index);
+                            continue;
+                        }
+                        auto& matcher = matchers[matcher_index];
+                        if (!matcher) {
+                            matcher.reset(new pattern::Matcher(pattern->get_pattern_value(),
+                                                               pattern->get_name(),
+                                                               pattern->is_strict_mode()));
+                        }
+                        if (matcher->match(node->output(0)))
+                            matches[i].matchers.push_back(matcher_index);
+                        matcher->clear_state();
+                    }
+                }
+            });
+            speculative_matches.reserve(matches.size());
+            for (size_t i = 0; i < matches.size(); i++)
+                speculative_matches.emplace(matched_nodes[i].get(), std::move(matches[i]));
+            matching_time = std::chrono::steady_clock::now() - start;
+        }
+    }
+
+    // set once any matcher pass is applied, until then the nodes are known to keep the state observed in advance
+    bool graph_changed = false;
+    std::unordered_set<const Node*> visited;
+    std::vector<std::pair<const Node*, int64_t>> to_visit;
+    auto find_match = [&](const Node* node) -> const SpeculativeMatch* {
+        const auto match = speculative_matches.find(node);
+        if (match == speculative_matches.end() || match->second.node.expired())
+            return nullptr;
+        return &match->second;
+    };
+    auto state_is_kept = [&](const Node* root) {
+        visited.clear();
+        to_visit.clear();
+        to_visit.emplace_back(root, 0);
+        while (!to_visit.empty()) {
+            const auto node = to_visit.back().first;
+            const auto depth = to_visit.back().second;
+            to_visit.pop_back();
+            if (!visited.insert(node).second)
+                continue;
+            const auto match = find_match(node);
+            if (!match || match->signature != node_signature(node))
+                return false;
+            if (depth < observed_depth) {
+                for (size_t i = 0; i < node->get_input_size(); i++)
+                    to_visit.emplace_back(node->get_input_node_ptr(i), depth + 1);
+            }
+        }
+        return true;
+    };
+    // returns the matchers matched the node in advance, or nullptr if all the matchers must be applied
+    auto find_speculative_match = [&](const Node* node) -> const std::vector<size_t>* {
+        const auto match = find_match(node);
+        if (!match || (graph_changed && !state_is_kept(node)))
+            return nullptr;
+        return &match->matchers;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -144,7 +381,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
+        graph_changed = true;
+        const auto start = profile ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
         bool status = m_pass->apply(node);
+        if (profile) {
+            auto& stats = matcher_stats[m_pass.get()];
+            stats.first += std::chrono::steady_clock::now() - start;
+            stats.second += status;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -186,22 +430,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
         if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+            // the matchers which didn't match the node in advance are not applied
+            if (const auto matched = find_speculative_match(node.get()))
+                matcher_passes_to_run = *matched;
+            else
+                collect_matchers(node.get(), matcher_passes_to_run);
 
             // TODO: type_to_matcher with just collected list of matchers to enable
             // fast processing at the next time when node with the same type will be processed
@@ -227,6 +460,23 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             }
         }
     }
+
+    if (profile) {
+        auto to_ms = [](std::chrono::steady_clock::duration duration) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+        };
+        if (!speculative_matches.empty()) {
+            std::cout << std::setw(7) << to_ms(matching_time) << "ms   " << get_name() << " matching of "
+                      << speculative_matches.size() << " nodes in advance\n";
+        }
+        for (const auto& m_pass : m_matchers) {
+            const auto stats = matcher_stats.find(m_pass.get());
+            if (stats == matcher_stats.end())
+                continue;
+            std::cout << std::setw(7) << to_ms(stats->second.first) << "ms   " << get_name()
+                      << "::" << m_pass->get_name() << " applied " << stats->second.second << " times\n";
+        }
+    }
     return rewritten;
 }
 
@@ -81,7 +81,9 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             }
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
-            function_changed = GraphRewrite(matcher_pass).run_on_model(func);
+            GraphRewrite rewrite(matcher_pass);
+            rewrite.set_pass_config(m_pass_config);
+            function_changed = rewrite.run_on_model(func);
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -4,9 +4,11 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <ngraph/variant.hpp>
 #include <unordered_map>
@@ -18,6 +20,7 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
+#include "openvino/util/xxhash.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -83,12 +86,19 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool write_data = true)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_write_data(write_data),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr, size_t size) {
+        if (!m_write_data) {
+            // only the layout of the data is tracked, the offsets don't depend on the data
+            const auto offset = m_data_size;
+            m_data_size += static_cast<FilePosition>(size);
+            return offset;
+        }
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
@@ -116,7 +126,9 @@ private:
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_write_data;
     FilePosition m_blob_offset;  // blob offset inside output stream
+    FilePosition m_data_size = 0;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -983,7 +995,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool write_constants_data = true) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1004,7 +1017,7 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, write_constants_data);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1196,8 +1209,58 @@ public:
         return n;
     }
 };
+
+constexpr size_t digest_chunk_size = 1 << 20;
+
+size_t chunks_count(size_t size) {
+    return std::max<size_t>(1, (size + digest_chunk_size - 1) / digest_chunk_size);
+}
+
+void collect_constants(const std::shared_ptr<ov::Model>& f, std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& op : f->get_ordered_ops()) {
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto multi_subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : multi_subgraph->get_functions())
+                collect_constants(body, constants);
+        }
+    }
+}
+
 }  // namespace
 
+bool ConstantDigestCache::find(const std::shared_ptr<ov::op::v0::Constant>& constant, uint64_t& digest) const {
+    // the shared memory may be changed by its owner, so its digest is never reused
+    if (constant->is_data_shared())
+        return false;
+    Entry entry;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_entries.find(constant.get());
+        if (found == m_entries.end())
+            return false;
+        entry = found->second;
+    }
+    if (entry.node.lock() != constant || entry.data != constant->get_data_ptr() ||
+        entry.size != constant->get_byte_size())
+        return false;
+    digest = entry.digest;
+    return true;
+}
+
+void ConstantDigestCache::insert(const std::shared_ptr<ov::op::v0::Constant>& constant, uint64_t digest) {
+    if (constant->is_data_shared())
+        return;
+    Entry entry{constant, constant->get_data_ptr(), constant->get_byte_size(), digest};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[constant.get()] = entry;
+    if (m_entries.size() >= m_cleanup_threshold) {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+            it = it->second.node.expired() ? m_entries.erase(it) : std::next(it);
+        m_cleanup_threshold = std::max<size_t>(64, m_entries.size() * 2);
+    }
+}
+
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     OstreamHashWrapper xmlHash;
     OstreamHashWrapper binHash;
@@ -1205,11 +1268,50 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     std::ostream bin(&binHash);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    // The structure is hashed without the constants data, the data is represented by the digests below
+    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true, false);
+
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+    collect_constants(f, constants);
+
+    // only the data without the memoized digest is hashed
+    std::vector<uint64_t> digests(constants.size(), 0);
+    std::vector<size_t> first_chunk(constants.size() + 1, 0);
+    for (size_t i = 0; i < constants.size(); i++) {
+        const bool is_memoized = m_digests && m_digests->find(constants[i], digests[i]);
+        first_chunk[i + 1] = first_chunk[i] + (is_memoized ? 0 : chunks_count(constants[i]->get_byte_size()));
+    }
+
+    std::vector<uint64_t> chunk_hashes(first_chunk.back());
+    auto hash_chunk_at = [&](size_t chunk) {
+        const auto found = std::upper_bound(first_chunk.begin(), first_chunk.end(), chunk) - first_chunk.begin() - 1;
+        const auto& constant = constants[found];
+        const auto offset = (chunk - first_chunk[found]) * digest_chunk_size;
+        const auto size = std::min(digest_chunk_size, constant->get_byte_size() - offset);
+        chunk_hashes[chunk] = ov::util::xxhash64(static_cast<const char*>(constant->get_data_ptr()) + offset, size);
+    };
+    if (m_parallel_for) {
+        m_parallel_for(chunk_hashes.size(), hash_chunk_at);
+    } else {
+        for (size_t chunk = 0; chunk < chunk_hashes.size(); chunk++)
+            hash_chunk_at(chunk);
+    }
+
+    uint64_t weights_seed = 0;
+    for (size_t i = 0; i < constants.size(); i++) {
+        if (first_chunk[i + 1] != first_chunk[i]) {
+            digests[i] = constants[i]->get_byte_size();
+            for (size_t chunk = first_chunk[i]; chunk < first_chunk[i + 1]; chunk++)
+                digests[i] = hash_combine(digests[i], chunk_hashes[chunk]);
+            if (m_digests)
+                m_digests->insert(constants[i], digests[i]);
+        }
+        weights_seed = hash_combine(weights_seed, digests[i]);
+    }
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    seed = hash_combine(seed, weights_seed);
 
     m_hash = seed;
     // Return false because we didn't change nGraph Function
@@ -1218,4 +1320,11 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
 
 pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
 
+pass::Hash::Hash(uint64_t& output_hash_value,
+                 ParallelFor parallel_for,
+                 std::shared_ptr<ConstantDigestCache> digests)
+    : m_hash(output_hash_value),
+      m_parallel_for(std::move(parallel_for)),
+      m_digests(std::move(digests)) {}
+
 }  // namespace ov
@@ -4,6 +4,7 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <thread>
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -3372,3 +3373,57 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, parallel_folding) {
+    // independent constant sub-graphs with the parameter dependent consumers, the sub-graphs are folded
+    // in parallel in the batches limited by the size of the folded constants
+    auto get_model = []() {
+        auto data = make_shared<opset5::Parameter>(element::f32, Shape{2, 3});
+        OutputVector outputs;
+        for (size_t i = 0; i < 8; i++) {
+            auto weights = opset5::Constant::create(element::i32, Shape{3, 2}, {0, 1, 2, 3, 4, 5});
+            auto convert = make_shared<opset5::Convert>(weights, element::f32);
+            auto order = opset5::Constant::create(element::i64, Shape{2}, {1, 0});
+            auto transpose = make_shared<opset5::Transpose>(convert, order);
+            auto scale = make_shared<opset5::Multiply>(transpose,
+                                                       opset5::Constant::create(element::f32, Shape{}, {i + 1.f}));
+            scale->set_friendly_name("scale_" + to_string(i));
+            outputs.push_back(make_shared<opset5::Add>(data, scale));
+        }
+        return make_shared<Function>(outputs, ParameterVector{data});
+    };
+    auto run = [](const std::shared_ptr<Function>& f, size_t max_parallel_folding_size) {
+        pass::Manager pass_manager;
+        pass_manager.get_pass_config()->set_parallel_for([](size_t count, const std::function<void(size_t)>& body) {
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < count; i++)
+                threads.emplace_back(body, i);
+            for (auto& thread : threads)
+                thread.join();
+        });
+        pass_manager.register_pass<pass::ConstantFolding>(max_parallel_folding_size);
+        pass_manager.run_passes(f);
+    };
+
+    // the unlimited batches and a node per batch
+    for (size_t max_parallel_folding_size : {std::numeric_limits<size_t>::max(), size_t{1}}) {
+        auto f = get_model();
+        run(f, max_parallel_folding_size);
+
+        ASSERT_EQ(count_ops_of_type<opset5::Convert>(f), 0);
+        ASSERT_EQ(count_ops_of_type<opset5::Transpose>(f), 0);
+        ASSERT_EQ(count_ops_of_type<opset5::Multiply>(f), 0);
+        ASSERT_EQ(count_ops_of_type<opset5::Add>(f), 8);
+        ASSERT_EQ(count_ops_of_type<opset5::Constant>(f), 8);
+        for (size_t i = 0; i < 8; i++) {
+            auto add = f->get_results().at(i)->get_input_node_shared_ptr(0);
+            auto folded = ov::as_type_ptr<op::Constant>(add->get_input_node_shared_ptr(1));
+            ASSERT_TRUE(folded);
+            ASSERT_EQ(folded->get_friendly_name(), "scale_" + to_string(i));
+            ASSERT_EQ(folded->get_shape(), (Shape{2, 3}));
+            const float scale = i + 1.f;
+            range_test_check(folded->cast_vector<float>(),
+                             vector<float>{0, 2 * scale, 4 * scale, scale, 3 * scale, 5 * scale});
+        }
+    }
+}
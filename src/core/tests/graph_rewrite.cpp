@@ -8,6 +8,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <thread>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -442,3 +444,156 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+class DivideToMultiply : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DivideToMultiply() {
+        auto divide = pattern::wrap_type<opset3::Divide>({pattern::any_input(), pattern::wrap_type<opset3::Constant>()});
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto divide = m.get_match_root();
+            auto constant = ov::as_type_ptr<opset3::Constant>(divide->get_input_node_shared_ptr(1));
+            auto values = constant->cast_vector<float>();
+            for (auto& value : values)
+                value = 1.f / value;
+            auto multiply = std::make_shared<opset3::Multiply>(
+                divide->input_value(0),
+                opset3::Constant::create(element::f32, constant->get_shape(), values));
+            ngraph::replace_node(divide, multiply);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(divide, "DivideToMultiply");
+        this->register_matcher(m, callback);
+    }
+};
+
+class EliminateDoubleRelu : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    EliminateDoubleRelu() {
+        auto relu = pattern::wrap_type<opset3::Relu>({pattern::wrap_type<opset3::Relu>()});
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto relu = m.get_match_root();
+            return ngraph::replace_output_update_name(relu->output(0), relu->input_value(0));
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "EliminateDoubleRelu");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(DivideToMultiply, "DivideToMultiply", 0);
+NGRAPH_RTTI_DEFINITION(EliminateDoubleRelu, "EliminateDoubleRelu", 0);
+
+TEST(GraphRewriteTest, ParallelMatchingResultsAreSame) {
+    // the model is large enough to be matched in parallel, the rewrites of each block change the nodes
+    // matched in advance by the other matchers
+    auto get_model = []() {
+        auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{1, 3});
+        Output<Node> last = data;
+        for (size_t i = 0; i < 600; i++) {
+            auto relu1 = std::make_shared<opset3::Relu>(last);
+            auto relu2 = std::make_shared<opset3::Relu>(relu1);
+            last = std::make_shared<opset3::Divide>(relu2,
+                                                    opset3::Constant::create(element::f32, Shape{1}, {2.f + i}));
+        }
+        return std::make_shared<Function>(OutputVector{last}, ParameterVector{data});
+    };
+    auto run = [](const std::shared_ptr<Function>& f, bool parallel) {
+        pass::Manager manager;
+        if (parallel) {
+            manager.get_pass_config()->set_parallel_for([](size_t count, const std::function<void(size_t)>& body) {
+                std::vector<std::thread> threads;
+                for (size_t i = 0; i < count; i++)
+                    threads.emplace_back(body, i);
+                for (auto& thread : threads)
+                    thread.join();
+            });
+        }
+        auto rewrite = manager.register_pass<pass::GraphRewrite>();
+        rewrite->add_matcher<EliminateDoubleRelu>();
+        rewrite->add_matcher<DivideToMultiply>();
+        manager.run_passes(f);
+    };
+
+    auto f = get_model();
+    run(f, true);
+    auto f_ref = get_model();
+    run(f_ref, false);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 600);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Multiply>(f), 600);
+    const auto res = FunctionsComparator::with_default().enable(FunctionsComparator::CONST_VALUES).compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+class MarkSigmoidConsumers : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkSigmoidConsumers() {
+        auto relu = pattern::wrap_type<opset3::Relu>();
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            // the runtime info of the consumers is changed in place, the graph is not
+            for (const auto& consumer : m.get_match_root()->get_output_target_inputs(0))
+                consumer.get_node()->get_rt_info()["mark"] = true;
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "MarkSigmoidConsumers");
+        this->register_matcher(m, callback);
+    }
+};
+
+class MarkedSigmoidToTanh : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkedSigmoidToTanh() {
+        auto sigmoid = pattern::wrap_type<opset3::Sigmoid>([](const Output<Node>& output) {
+            const auto& rt_info = output.get_node()->get_rt_info();
+            const auto mark = rt_info.find("mark");
+            return mark != rt_info.end() && mark->second.as<bool>();
+        });
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            auto sigmoid = m.get_match_root();
+            auto tanh = std::make_shared<opset3::Tanh>(sigmoid->input_value(0));
+            ngraph::replace_node(sigmoid, tanh);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(sigmoid, "MarkedSigmoidToTanh");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(MarkSigmoidConsumers, "MarkSigmoidConsumers", 0);
+NGRAPH_RTTI_DEFINITION(MarkedSigmoidToTanh, "MarkedSigmoidToTanh", 0);
+
+TEST(GraphRewriteTest, ParallelMatchingAppliesPredicatesToChangedNodes) {
+    // the predicate observes the runtime info changed by the previous matcher after the matching in advance
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{1, 3});
+    Output<Node> last = data;
+    for (size_t i = 0; i < 600; i++) {
+        auto sigmoid = std::make_shared<opset3::Sigmoid>(std::make_shared<opset3::Relu>(last));
+        sigmoid->get_rt_info()["mark"] = false;
+        last = sigmoid;
+    }
+    auto f = std::make_shared<Function>(OutputVector{last}, ParameterVector{data});
+
+    pass::Manager manager;
+    manager.get_pass_config()->set_parallel_for([](size_t count, const std::function<void(size_t)>& body) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < count; i++)
+            threads.emplace_back(body, i);
+        for (auto& thread : threads)
+            thread.join();
+    });
+    auto rewrite = manager.register_pass<pass::GraphRewrite>();
+    rewrite->add_matcher<MarkSigmoidConsumers>();
+    rewrite->add_matcher<MarkedSigmoidToTanh>();
+    manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Sigmoid>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 600);
+}
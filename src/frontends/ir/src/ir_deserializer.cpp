@@ -4,9 +4,12 @@
 
 #include "ir_deserializer.hpp"
 
+#include <exception>
+#include <mutex>
 #include <pugixml.hpp>
 
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "rt_info_deserializer.hpp"
@@ -16,6 +19,36 @@
 
 using namespace ov;
 
+namespace {
+// the fewer layers or edges are processed serially as it doesn't pay off
+constexpr size_t min_items_to_deserialize_in_parallel = 256;
+
+// Runs the body for the indices [0, count) in parallel, the exception thrown by the body is rethrown
+template <typename F>
+void deserialize_in_parallel(size_t count, const F& body) {
+    if (count < min_items_to_deserialize_in_parallel) {
+        for (size_t i = 0; i < count; i++)
+            body(i);
+        return;
+    }
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    InferenceEngine::parallel_for(count, [&](size_t i) {
+        try {
+            body(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+}
+}  // namespace
+
+static const std::string& translate_type_name(const std::string& name);
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -427,13 +460,17 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    // Read all layers and store their parameters in params map, the layers are parsed in parallel
+    std::vector<node_params> layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back({node, {}}); }
+    deserialize_in_parallel(layers.size(), [&](size_t i) {
+        layers[i].params = parseGenericParams(layers[i].xml);
+    });
+    for (auto& layer : layers) {
+        const auto& node_param = layer.params;
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -444,15 +481,23 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        params[node_param.layerId] = std::move(layer);
     }
 
-    // Read all edges and store them for further usage
-    FOREACH_CHILD (_ec, root.child("edges"), "edge") {
+    // Read all edges and store them for further usage, the edges are parsed in parallel
+    std::vector<pugi::xml_node> edge_nodes;
+    FOREACH_CHILD (_ec, root.child("edges"), "edge") { edge_nodes.push_back(_ec); }
+    std::vector<std::pair<size_t /*to-layer-id*/, edge>> parsed_edges(edge_nodes.size());
+    deserialize_in_parallel(edge_nodes.size(), [&](size_t i) {
+        const auto& _ec = edge_nodes[i];
         size_t fromLayer = XMLParseUtils::GetUIntAttr(_ec, "from-layer");
         size_t fromPort = XMLParseUtils::GetUIntAttr(_ec, "from-port");
         size_t toLayer = XMLParseUtils::GetUIntAttr(_ec, "to-layer");
         size_t toPort = XMLParseUtils::GetUIntAttr(_ec, "to-port");
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+        parsed_edges[i] = std::make_pair(toLayer, edge{fromLayer, fromPort, toPort});
+    });
+    for (const auto& parsed_edge : parsed_edges) {
+        edges[parsed_edge.first].push_back(parsed_edge.second);
     }
 
     // Run DFS starting from outputs to get nodes topological order
@@ -473,29 +518,58 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // The nodes without inputs (constants and parameters) don't depend on other nodes, so they are created
+    // concurrently. Other nodes are created serially as the shape inference of the node may evaluate and store
+    // the bounds of the values in the tensors of its producers which are shared with other consumers.
+    // The nodes with the sub-graphs, variables or created by the extensions are created serially too.
+    auto is_independent = [&](const node_params& p) {
+        const auto& type_name = translate_type_name(p.params.type);
+        const auto data = p.xml.child("data");
+        return !p.xml.child("body") && !p.xml.child("then_body") && !p.xml.child("else_body") &&
+               !data.attribute("variable_id") &&
+               !m_extensions.count(ov::DiscreteTypeInfo(type_name.c_str(), 0, p.params.version.c_str()));
+    };
+    std::vector<size_t> independent_layers;
+    for (auto& layer_id : order) {
+        const auto& edgeIt = edges.find(layer_id);
+        if (edgeIt != edges.end() && edgeIt->second.empty() && is_independent(params[layer_id]))
+            independent_layers.push_back(layer_id);
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> independent_nodes(independent_layers.size());
+    deserialize_in_parallel(independent_layers.size(), [&](size_t i) {
+        const auto& p = params.at(independent_layers[i]);
+        independent_nodes[i] = createNode({}, p.xml, weights, p.params);
+    });
+    for (size_t i = 0; i < independent_layers.size(); i++) {
+        id_to_node[independent_layers[i]] = std::move(independent_nodes[i]);
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
-        ngraph::OutputVector inputs(edgeIt->second.size());
-        for (auto& e : edgeIt->second) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+        // the independent nodes are already created
+        auto node = id_to_node[layer_id];
+        if (!node) {
+            ngraph::OutputVector inputs(edgeIt->second.size());
+            for (auto& e : edgeIt->second) {
+                auto input_node = id_to_node[e.fromLayerId];
+                if (!input_node) {
+                    IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+                }
+                auto& p_output = params[e.fromLayerId].params;
+                size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
+                if (realInputPortId >= inputs.size())
+                    IE_THROW() << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
+                               << " is inconsistent!";
+                inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
             }
-            auto& p_output = params[e.fromLayerId].params;
-            size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
-            if (realInputPortId >= inputs.size())
-                IE_THROW() << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
-                           << " is inconsistent!";
-            inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
-
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
 
+            node = createNode(inputs, p.xml, weights, p.params);
+            id_to_node[layer_id] = node;
+        }
         // Check that output shape after OpenVINO node validation the same as in IR
         // because IR always right!
         // Temporary disabled!
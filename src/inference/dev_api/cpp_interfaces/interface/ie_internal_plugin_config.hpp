@@ -46,6 +46,13 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Binds all the CPU Executor Streams to the NUMA node with the given ID instead of distributing them between the
+ * NUMA nodes, has effect with the NUMA thread binding
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_NODE_ID);
+
 /**
  * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
  * stream
@@ -53,6 +60,40 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables concurrent execution of independent graph branches inside one CPU stream (YES/NO)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief Defines the scope of the CPU runtime parameters cache: one cache per stream (STREAM), one thread safe cache shared
+ * by all the streams of an executable network (NETWORK) or by all the networks loaded to the plugin (PLUGIN)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARING);
+
+/**
+ * @brief Read-only executable network metric with the CPU runtime parameters cache counters: number of hits, misses and
+ * total time in microseconds spent to build the missing records
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_STATISTICS);
+
+/**
+ * @brief Enables storing of the CPU JIT kernels code in the cache directory (YES/NO), takes effect only if CACHE_DIR is set.
+ * Enabled by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_JIT_CODE_CACHE);
+
+/**
+ * @brief Keeps the compressed (FP16/INT8) MatMul weights compressed in the CPU plugin memory (YES/NO), the weights are
+ * decompressed on the fly by FullyConnected. Disabled by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_COMPRESSED_WEIGHTS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -9,13 +9,19 @@
  */
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -56,6 +62,7 @@ public:
      *
      * Client needs to call create std::istream object and call reader(istream)
      * Otherwise, network will not be read from cache and will be loaded as usual
+     * The stream may be backed by ov::MappedStreamBuffer, so the reader can refer the data of the entry directly
      *
      * @param id Id of cache (hash of the network)
      * @param reader Lambda function to be called when input stream is created
@@ -76,6 +83,9 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * The files are mapped to the memory for reading, so the processes which read the same cached model share
+ * the page cache. The file is written under a unique temporary name and then renamed to keep the existing mappings
+ * valid.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
@@ -85,6 +95,16 @@ class FileStorageCacheManager final : public ICacheManager {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    // the name is unique for each write, so the threads and processes writing the same entry don't share the file
+    static std::string getTmpFile(const std::string& blobFileName) {
+        static std::atomic<uint64_t> counter{0};
+        std::random_device device;
+        std::stringstream suffix;
+        suffix << std::hex << device() << "_" << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_"
+               << std::chrono::steady_clock::now().time_since_epoch().count() << "_" << counter++;
+        return blobFileName + "." + suffix.str() + ".tmp";
+    }
+
 public:
     /**
      * @brief Constructor
@@ -100,15 +120,44 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        auto blobFileName = getBlobFile(id);
+        auto tmpFileName = getTmpFile(blobFileName);
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            try {
+                writer(stream);
+            } catch (...) {
+                // the partially written file is never renamed, so it is not left in the cache directory
+                stream.close();
+                std::remove(tmpFileName.c_str());
+                throw;
+            }
+        }
+        // the file which is mapped by a reader can't be replaced on Windows, the existing entry is kept then
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+            std::remove(blobFileName.c_str());
+            if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0)
+                std::remove(tmpFileName.c_str());
+        }
     }
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            std::shared_ptr<ngraph::runtime::AlignedBuffer> mapping;
+            try {
+                mapping = ov::load_mmap_object(blobFileName);
+            } catch (...) {
+                // the file can't be mapped, it is read by the regular stream
+            }
+            if (mapping && mapping->size() > 0) {
+                ov::MappedStreamBuffer buffer(mapping);
+                std::istream stream(&buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
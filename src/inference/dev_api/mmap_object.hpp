@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+
+#include "ie_api.h"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ov {
+
+/**
+ * @brief Maps the file into the memory in the read-only mode
+ * @param path The file path
+ * @return The buffer which owns the mapping, the mapping is released with the last buffer owner
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<ngraph::runtime::AlignedBuffer>) load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<ngraph::runtime::AlignedBuffer>) load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief The stream buffer over the mapped memory, the reading from the stream doesn't use the intermediate buffers.
+ *
+ * The readers which are aware of the mapping may refer the data of the stream directly instead of reading it:
+ * @code
+ * if (auto mapped = dynamic_cast<ov::MappedStreamBuffer*>(stream.rdbuf())) {
+ *     // mapped->mapping()->get_ptr<char>() + stream.tellg() is the current data, keep the mapping while it is used
+ * }
+ * @endcode
+ */
+class INFERENCE_ENGINE_API_CLASS(MappedStreamBuffer) : public std::streambuf {
+public:
+    explicit MappedStreamBuffer(std::shared_ptr<ngraph::runtime::AlignedBuffer> mapping);
+    ~MappedStreamBuffer() override;
+
+    /**
+     * @brief The mapping of the whole stream, the stream positions are the offsets inside the mapping
+     */
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& mapping() const noexcept {
+        return m_mapping;
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override;
+    std::streamsize showmanyc() override;
+
+private:
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> m_mapping;
+};
+
+}  // namespace ov
@@ -95,6 +95,8 @@ public:
                                        //!< starting from offset
         int _threads = 0;              //!< Number of threads distributed between streams.
                                        //!< Reserved. Should not be used.
+        int _numaNodeId = -1;          //!< In case of @ref NUMA binding all the streams are bound to the NUMA node
+                                       //!< with this ID, -1 distributes the streams between the NUMA nodes
         enum PreferredCoreType {
             ANY,
             LITTLE,
@@ -7,6 +7,8 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <type_traits>
@@ -45,6 +47,91 @@ protected:
     std::queue<T> _queue;
     std::mutex _mutex;
 };
+
+/**
+ * @brief The bounded lock-free multi-producer multi-consumer queue (D. Vyukov's algorithm).
+ *        Every cell carries the sequence number which tells whether the cell is ready for the push or for the pop,
+ *        so the producers and the consumers contend only on the cells they reserve.
+ */
+template <typename T>
+class ThreadSafeBoundedLockFreeQueue {
+public:
+    /**
+     * @param capacity The maximal number of elements, rounded up to the power of two
+     */
+    explicit ThreadSafeBoundedLockFreeQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity)
+            size *= 2;
+        _cells.reset(new Cell[size]);
+        _mask = size - 1;
+        for (std::size_t i = 0; i < size; i++)
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+    }
+    ThreadSafeBoundedLockFreeQueue(const ThreadSafeBoundedLockFreeQueue&) = delete;
+    ThreadSafeBoundedLockFreeQueue& operator=(const ThreadSafeBoundedLockFreeQueue&) = delete;
+
+    /**
+     * @brief The value is moved to the queue only on success, it is kept intact when the queue is full
+     */
+    bool try_push(T&& value) {
+        Cell* cell = nullptr;
+        auto pos = _pushPos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _pushPos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _popPos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _popPos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        // the resources owned by the value are not held by the queue
+        cell->_value = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        T _value;
+    };
+    static constexpr std::size_t cacheLineSize = 64;
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    char _pad0[cacheLineSize];
+    std::atomic<std::size_t> _pushPos = {0};
+    char _pad1[cacheLineSize];
+    std::atomic<std::size_t> _popPos = {0};
+    char _pad2[cacheLineSize];
+};
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
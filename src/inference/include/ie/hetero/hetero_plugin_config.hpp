@@ -34,5 +34,14 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of splitting the network into the pipeline stages, one stage per NUMA node.
+ * The network is split by the latencies of the layers profiled on the device and the size of the tensors passed
+ * between the NUMA nodes, the streams of each stage are bound to its NUMA node. The single device must be set in
+ * the device priorities, the network shapes must be static.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(NUMA_PIPELINE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -285,6 +286,28 @@ public:
         return compile_model(model, context, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Starts the creation of a compiled model from a source model object in the background.
+     *
+     * The models are compiled on a pool shared by the calls of the Core object, the pool runs a bounded number of
+     * compilations at once and queues the rest. The model must not be changed until the future is ready.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @param warm_up_shapes Optional sets of representative input shapes, a shape per model input in the order of
+     * Model::inputs(). An empty set stands for the static input shapes of the model. Before the future is ready,
+     * ov::optimal_number_of_infer_requests inferences run at once with each set, so the device primitives and the
+     * executors of the dynamic shapes are created ahead of the first inferences of the caller. The warm-up errors
+     * and the sets of a wrong size are ignored, the compiled model is returned anyway.
+     * @return The future of a compiled model, it rethrows the compilation errors.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {},
+                                                   const std::vector<std::vector<ov::Shape>>& warm_up_shapes = {});
+
     /**
      * @deprecated This method is deprecated. Please use other Core::add_extension methods.
      * @brief Registers OpenVINO 1.0 extension to a Core object.
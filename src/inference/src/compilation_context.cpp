@@ -16,6 +16,7 @@
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
 #include "openvino/pass/manager.hpp"
@@ -64,7 +65,8 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 }
 
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
-                                                   const std::map<std::string, std::string>& compileOptions) {
+                                                   const std::map<std::string, std::string>& compileOptions,
+                                                   const std::shared_ptr<ov::ConstantDigestCache>& constantDigests) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
 
     IE_ASSERT(network.getFunction());
@@ -74,7 +76,12 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(
+        seed,
+        [](size_t count, const std::function<void(size_t)>& body) {
+            parallel_for(count, body);
+        },
+        constantDigests);
     m.run_passes(net.getFunction());
 
     // 2. Compute hash on serialized data and options
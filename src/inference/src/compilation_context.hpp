@@ -6,9 +6,14 @@
 
 #include <istream>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 
+namespace ov {
+class ConstantDigestCache;
+}  // namespace ov
+
 namespace InferenceEngine {
 
 class CNNNetwork;
@@ -16,7 +21,12 @@ class CNNNetwork;
 struct NetworkCompilationContext final {
     static std::string calculateFileInfo(const std::string& filePath);
 
-    static std::string computeHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions);
+    /**
+     * @param constantDigests The memo of the constants data digests kept by the caller between the calls, may be null
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::map<std::string, std::string>& compileOptions,
+                                   const std::shared_ptr<ov::ConstantDigestCache>& constantDigests = nullptr);
 
     static std::string computeHash(const std::string& modelName,
                                    const std::map<std::string, std::string>& compileOptions);
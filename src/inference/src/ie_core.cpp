@@ -6,10 +6,12 @@
 
 #include <sys/stat.h>
 
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "any_copy.hpp"
@@ -42,6 +44,8 @@
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_extension.hpp"
+#include "threading/ie_executor_manager.hpp"
+#include "transformations/hash.hpp"
 #include "xml_parse_utils.h"
 
 #ifdef OPENVINO_STATIC_LIBRARY
@@ -65,6 +69,9 @@ struct Parsed {
 
 namespace {
 
+// The number of the models compiled at once by Core::compile_model_async
+constexpr unsigned int maxAsyncCompilations = 4;
+
 #ifndef OPENVINO_STATIC_LIBRARY
 
 std::string parseXmlConfig(const std::string& xmlFile) {
@@ -266,8 +273,15 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    // The digests of the constants data of the cached networks, so the same model isn't hashed again
+    std::shared_ptr<ov::ConstantDigestCache> constantDigests = std::make_shared<ov::ConstantDigestCache>();
+
     const bool newAPI;
 
+    // The pool of the background compilations, it is owned by the executor manager, so the tasks may outlive Core
+    ie::ITaskExecutor::Ptr asyncCompileExecutor;
+    std::mutex asyncCompileMutex;
+
     bool DeviceSupportsImportExport(const std::string& deviceName) const override {
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         auto plugin = GetCPPPluginByName(parsed._deviceName);
@@ -411,7 +425,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                      const ov::InferencePlugin& plugin,
                                      const std::map<std::string, std::string>& config) const {
         auto compileConfig = CreateCompileConfig(plugin, deviceFamily, config);
-        return ie::NetworkCompilationContext::computeHash(network, compileConfig);
+        return ie::NetworkCompilationContext::computeHash(network, compileConfig, constantDigests);
     }
 
     std::string CalculateFileHash(const std::string& modelName,
@@ -436,6 +450,23 @@ public:
 
     ~CoreImpl() override = default;
 
+    /**
+     * @brief Returns the pool of the background compilations, it runs a bounded number of compilations at once
+     * @return The executor shared by all the background compilations of the Core object
+     */
+    ie::ITaskExecutor::Ptr GetAsyncCompileExecutor() {
+        std::lock_guard<std::mutex> lock(asyncCompileMutex);
+        if (!asyncCompileExecutor) {
+            // each compilation is parallel inside, so a few of them are enough to load the machine. Every stream may
+            // use all the cores, so the single compilation is not slowed down, the concurrent ones share the cores
+            const int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+            const int streams = std::min(static_cast<int>(maxAsyncCompilations), threads);
+            asyncCompileExecutor =
+                ie::executorManager()->getIdleCPUStreamsExecutor({"CoreAsyncCompilation", streams, threads});
+        }
+        return asyncCompileExecutor;
+    }
+
     /**
      * @brief Register plugins for devices which are located in .xml configuration file.
      * @note The function supports UNICODE path
@@ -1804,6 +1835,71 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config,
+                                                     const std::vector<std::vector<ov::Shape>>& warmUpShapes) {
+    auto promise = std::make_shared<std::promise<CompiledModel>>();
+    auto future = promise->get_future();
+    // the copy of the Core shares the implementation, it keeps the plugins alive until the task is done
+    Core core(*this);
+    _impl->GetAsyncCompileExecutor()->run([core, model, deviceName, config, warmUpShapes, promise]() mutable {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::compile_model_async");
+        CompiledModel compiledModel;
+        try {
+            compiledModel = core.compile_model(model, deviceName, config);
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+            return;
+        }
+        // The warm-up only creates the resources ahead of time, so its errors (e.g. a shape the device can't
+        // infer) are ignored: the same errors are reported by the inferences of the caller.
+        try {
+            if (!warmUpShapes.empty()) {
+                // the requests run at once as in the application, so each of them gets its device resources
+                const auto requestsNumber =
+                    std::max(1u, compiledModel.get_property(ov::optimal_number_of_infer_requests));
+                std::vector<InferRequest> requests;
+                for (unsigned int i = 0; i < requestsNumber; i++) {
+                    requests.push_back(compiledModel.create_infer_request());
+                }
+                const auto& inputs = compiledModel.inputs();
+                for (const auto& shapes : warmUpShapes) {
+                    if (!shapes.empty() && shapes.size() != inputs.size())
+                        continue;
+                    try {
+                        for (size_t i = 0; i < inputs.size(); i++) {
+                            ov::Tensor tensor(inputs[i].get_element_type(),
+                                              shapes.empty() ? inputs[i].get_shape() : shapes[i]);
+                            std::memset(tensor.data(), 0, tensor.get_byte_size());
+                            for (auto& request : requests) {
+                                request.set_tensor(inputs[i], tensor);
+                            }
+                        }
+                        for (auto& request : requests) {
+                            request.start_async();
+                        }
+                        for (auto& request : requests) {
+                            request.wait();
+                        }
+                    } catch (...) {
+                        // the started requests are finished before the next set is set to them
+                        for (auto& request : requests) {
+                            try {
+                                request.wait();
+                            } catch (...) {
+                            }
+                        }
+                    }
+                }
+            }
+        } catch (...) {
+        }
+        promise->set_value(compiledModel);
+    });
+    return future;
+}
+
 void Core::add_extension(const ie::IExtensionPtr& extension) {
     OV_CORE_CALL_STATEMENT(_impl->AddExtension(extension););
 }
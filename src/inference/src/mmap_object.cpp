@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_object.hpp"
+
+namespace ov {
+
+MappedStreamBuffer::MappedStreamBuffer(std::shared_ptr<ngraph::runtime::AlignedBuffer> mapping)
+    : m_mapping(std::move(mapping)) {
+    auto begin = m_mapping->get_ptr<char>();
+    setg(begin, begin, begin + m_mapping->size());
+}
+
+MappedStreamBuffer::~MappedStreamBuffer() = default;
+
+MappedStreamBuffer::pos_type MappedStreamBuffer::seekoff(off_type off,
+                                                         std::ios_base::seekdir dir,
+                                                         std::ios_base::openmode which) {
+    off_type base = 0;
+    if (dir == std::ios_base::cur) {
+        base = gptr() - eback();
+    } else if (dir == std::ios_base::end) {
+        base = egptr() - eback();
+    }
+    return seekpos(base + off, which);
+}
+
+MappedStreamBuffer::pos_type MappedStreamBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+    const off_type offset = pos;
+    if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback())
+        return pos_type(off_type(-1));
+    setg(eback(), eback() + offset, egptr());
+    return pos;
+}
+
+std::streamsize MappedStreamBuffer::showmanyc() {
+    const auto avail = egptr() - gptr();
+    return avail > 0 ? avail : -1;
+}
+
+}  // namespace ov
@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
 #include <memory>
@@ -21,10 +22,18 @@
 #include "ie_system_conf.h"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
+#include "threading/ie_thread_safe_containers.hpp"
 
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+// the capacity of the lock-free queue of each stream, the tasks beyond it go to the locked queue
+constexpr std::size_t streamQueueCapacity = 1024;
+// the time the idle stream keeps looking for the tasks before it is parked
+constexpr std::chrono::microseconds spinTime{50};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -186,7 +195,9 @@ struct CPUStreamsExecutor::Impl {
               return std::make_shared<Impl::Stream>(this);
           }) {
         auto numaNodes = getAvailableNUMANodes();
-        if (_config._streams != 0) {
+        if (_config._numaNodeId != -1) {
+            _usedNumaNodes = {_config._numaNodeId};
+        } else if (_config._streams != 0) {
             std::copy_n(std::begin(numaNodes),
                         std::min(static_cast<std::size_t>(_config._streams), numaNodes.size()),
                         std::back_inserter(_usedNumaNodes));
@@ -215,35 +226,93 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _streamQueues.emplace_back(new ThreadSafeBoundedLockFreeQueue<Task>{streamQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (TryPop(streamId, task) || SpinAndPop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        continue;
                     }
+                    // no tasks for a while, parking the thread until the next task
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _numParkedThreads++;
+                    _queueCondVar.wait(lock, [&] {
+                        return _numPendingTasks > 0 || (stopped = _isStopped);
+                    });
+                    _numParkedThreads--;
                 }
             });
         }
     }
 
     void Enqueue(Task task) {
-        {
+        const std::size_t numQueues = _streamQueues.size();
+        // the task from the stream thread goes to the stream own queue (to keep the data hot in its caches),
+        // the tasks from the other threads are spread over the streams in the round-robin fashion
+        std::size_t queueId = numQueues;
+        const auto threadId = std::this_thread::get_id();
+        for (std::size_t i = 0; i < numQueues && queueId == numQueues; i++) {
+            if (_threads[i].get_id() == threadId)
+                queueId = i;
+        }
+        if (queueId == numQueues)
+            queueId = _nextQueueId++ % numQueues;
+        bool pushed = false;
+        for (std::size_t i = 0; i < numQueues && !pushed; i++) {
+            pushed = _streamQueues[(queueId + i) % numQueues]->try_push(std::move(task));
+        }
+        if (!pushed) {
+            // all the queues are full, the tasks overflow to the locked queue
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            _numOverflowTasks++;
+        }
+        // the parked thread increments the counter before checking for the pending tasks under the lock,
+        // so either it sees the task or it is notified here
+        _numPendingTasks++;
+        if (_numParkedThreads > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
+    }
+
+    bool TryPop(const std::size_t queueId, Task& task) {
+        if (_numPendingTasks <= 0)
+            return false;
+        const std::size_t numQueues = _streamQueues.size();
+        bool popped = _streamQueues[queueId]->try_pop(task);
+        if (!popped && _numOverflowTasks > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _numOverflowTasks--;
+                popped = true;
+            }
+        }
+        // stealing the tasks from the other streams
+        for (std::size_t i = 1; i < numQueues && !popped; i++) {
+            popped = _streamQueues[(queueId + i) % numQueues]->try_pop(task);
+        }
+        if (popped)
+            _numPendingTasks--;
+        return popped;
+    }
+
+    bool SpinAndPop(const std::size_t queueId, Task& task) {
+        // spinning for a short while before the parking avoids the wake-up latency for the back-to-back tasks
+        const auto deadline = std::chrono::steady_clock::now() + spinTime;
+        do {
+            std::this_thread::yield();
+            if (TryPop(queueId, task))
+                return true;
+        } while (std::chrono::steady_clock::now() < deadline);
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,9 +349,14 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<ThreadSafeBoundedLockFreeQueue<Task>>> _streamQueues;
+    std::atomic<std::size_t> _nextQueueId = {0};
+    std::atomic<int> _numPendingTasks = {0};
+    std::atomic<int> _numParkedThreads = {0};
+    std::atomic<int> _numOverflowTasks = {0};
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::queue<Task> _taskQueue;  // the tasks which didn't fit the stream queues
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
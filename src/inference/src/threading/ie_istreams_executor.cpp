@@ -27,6 +27,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID),
         ov::num_streams.name(),
         ov::inference_num_threads.name(),
         ov::affinity.name(),
@@ -150,6 +151,20 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID)
+                       << ". Expected only the IDs of the available NUMA nodes or -1";
+        }
+        const auto numaNodes = getAvailableNUMANodes();
+        if (val_i != -1 && std::find(numaNodes.begin(), numaNodes.end(), val_i) == numaNodes.end()) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID)
+                       << ". There is no NUMA node with ID " << val_i;
+        }
+        _numaNodeId = val_i;
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -188,6 +203,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) const {
         return decltype(ov::inference_num_threads)::value_type{_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID)) {
+        return {std::to_string(_numaNodeId)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -231,6 +248,10 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
         }
     }
 #endif
+    if (streamExecutorConfig._numaNodeId != -1) {
+        // the streams bound to one NUMA node use its cores only
+        num_cores_default = std::max(1, num_cores_default / numaNodesNum);
+    }
     const auto hwCores = !bLatencyCase && numaNodesNum == 1
                              // throughput case on a single-NUMA node machine uses all available cores
                              ? parallel_get_max_threads()
@@ -177,7 +177,9 @@ struct TBBStreamsExecutor::Impl {
                                         static_cast<std::size_t>(_config._streams * _config._threadsPerStream + 1)});
         }
         auto numaNodes = getAvailableNUMANodes();
-        if (_config._streams != 0) {
+        if (_config._numaNodeId != -1) {
+            _usedNumaNodes = {_config._numaNodeId};
+        } else if (_config._streams != 0) {
             std::copy_n(std::begin(numaNodes),
                         std::min(static_cast<std::size_t>(_config._streams), numaNodes.size()),
                         std::back_inserter(_usedNumaNodes));
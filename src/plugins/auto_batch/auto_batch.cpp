@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -333,13 +334,19 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +354,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -365,7 +372,29 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToPartialRequest(SoIInferRequestInternal& req, size_t slot, size_t batchSize) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, slot, batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromPartialRequest(SoIInferRequestInternal& req,
+                                                          size_t slot,
+                                                          size_t batchSize) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, slot, batchSize);
     }
 }
 
@@ -387,7 +416,18 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
+            const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count();
+            const int64_t last = workerInferRequest._lastArrival.exchange(now);
+            // only the arrivals within the same batch collection tell the rate the batch is filled with,
+            // the interval is smoothed over the recent arrivals
+            if (sz > 1 && now > last) {
+                const int64_t interval = workerInferRequest._arrivalInterval;
+                workerInferRequest._arrivalInterval = interval ? (7 * interval + (now - last)) / 8 : now - last;
+            }
+            // the worker re-evaluates the time to wait for the batch when the collection starts or is complete
+            if (sz == workerInferRequest._batchSize || sz == 1) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -399,7 +439,8 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
                       auto& batchReq = this->_inferRequest->_myBatchedRequestWrapper;
                       if (batchReq._exceptionPtr)  // when the batchN execution failed
                           std::rethrow_exception(batchReq._exceptionPtr);
-                      // in the case of non-batched execution the blobs were set explicitly
+                      // in the case of non-batched execution the blobs were set explicitly,
+                      // in the case of partial batch the outputs are copied on the partial request completion
                       if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                           this->_inferRequest->_wasBatchedRequestUsed)
                           this->_inferRequest->CopyOutputsIfNeeded();
@@ -411,6 +452,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_inferRequestPartial->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -430,11 +473,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    std::function<InferenceEngine::SoExecutableNetworkInternal(int)> loadNetworkWithBatch)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _loadNetworkWithBatch{std::move(loadNetworkWithBatch)},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -451,6 +496,10 @@ AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
         w->_thread.join();
     }
     _workerRequests.clear();
+    // the pending loads of the smaller batches are cancelled, only the one in progress is waited for
+    for (auto& network : _networksWithPartialBatch)
+        network.second.wait();
+    _networksWithPartialBatch.clear();
 }
 
 unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s) {
@@ -460,6 +509,21 @@ unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s)
     return val;
 }
 
+std::chrono::microseconds AutoBatchExecutableNetwork::GetCollectionTimeout(
+    const WorkerInferRequest& workerRequest) const {
+    const auto timeout = std::chrono::microseconds(static_cast<int64_t>(_timeOut) * 1000);
+    const int sz = workerRequest._tasks.size();
+    const int64_t interval = workerRequest._arrivalInterval;
+    if (!sz || !interval)
+        return timeout;
+    // no reason to wait longer than the batch is expected to be filled at the current arrival rate (with a margin),
+    // and if the batch can't be filled within the timeout anyway, the requests wait only for the next arrival
+    const auto expected = std::chrono::microseconds(2 * interval * (workerRequest._batchSize - sz));
+    if (expected <= timeout)
+        return expected;
+    return std::min(timeout, std::chrono::microseconds(2 * interval));
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _networkWithoutBatch->GetContext();
 }
@@ -523,7 +587,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, GetCollectionTimeout(*workerRequestPtr));
                 }
                 if (_terminate) {
                     break;
@@ -540,30 +604,13 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        _numCollections++;
+                        _numCollectedRequests += sz;
+                        _numFullBatches++;
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
-                        }
-                        all_completed_future.get();
+                        // timeout to collect the batch is over, have to execute the requests collected by the moment
+                        ExecutePartialBatch(*workerRequestPtr, sz);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -573,6 +620,133 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     return {*_workerRequests.back(), batch_id};
 }
 
+InferenceEngine::SoIInferRequestInternal* AutoBatchExecutableNetwork::GetPartialBatchRequest(
+    WorkerInferRequest& workerRequest,
+    int batch) {
+    auto found = workerRequest._inferRequestsPartial.find(batch);
+    if (found != workerRequest._inferRequestsPartial.end())
+        return found->second ? &found->second : nullptr;
+    if (!_loadNetworkWithBatch)
+        return nullptr;
+
+    std::shared_future<SoExecutableNetworkInternal> network;
+    {
+        std::lock_guard<std::mutex> lock(_networksWithPartialBatchMutex);
+        auto loading = _networksWithPartialBatch.find(batch);
+        if (loading == _networksWithPartialBatch.end()) {
+            // the loads run one at a time, so the ones not started yet are cancelled once the network is destroyed
+            auto future = std::async(std::launch::async, [this, batch] {
+                std::lock_guard<std::mutex> lock(_partialBatchLoadMutex);
+                if (_terminate)
+                    IE_THROW() << "The load of the network with batch " << batch << " is cancelled";
+                return _loadNetworkWithBatch(batch);
+            });
+            loading = _networksWithPartialBatch.emplace(batch, future.share()).first;
+        }
+        network = loading->second;
+    }
+    if (network.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return nullptr;
+    auto& request = workerRequest._inferRequestsPartial[batch];
+    try {
+        request = {network.get()->CreateInferRequest(), network.get()._so};
+    } catch (...) {
+        // the batch which fails to load is executed as several smaller batches or with batch1 instead
+        return nullptr;
+    }
+    return &request;
+}
+
+void AutoBatchExecutableNetwork::ExecutePartialBatch(WorkerInferRequest& workerRequest, int numRequests) {
+    std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(numRequests);
+    for (auto& t : tasks)
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+    _numCollections++;
+    _numCollectedRequests += numRequests;
+
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    auto completeTask = [numRequests, &arrived, &all_completed](const InferenceEngine::Task& task) {
+        task();
+        if (numRequests == ++arrived)
+            all_completed.set_value();
+    };
+    // the largest power of two below the device batch
+    int largestBatch = 1;
+    while (largestBatch * 2 < workerRequest._batchSize)
+        largestBatch *= 2;
+    int n = 0;
+    while (n < numRequests) {
+        const int remaining = numRequests - n;
+        // the smallest batch to fit the remaining requests, otherwise the largest one, or the smaller loaded one
+        int batchSize = 1;
+        while (batchSize < remaining && batchSize < largestBatch)
+            batchSize *= 2;
+        SoIInferRequestInternal* req = nullptr;
+        for (; remaining > 1 && batchSize > 1; batchSize /= 2) {
+            req = GetPartialBatchRequest(workerRequest, batchSize);
+            if (req)
+                break;
+        }
+        if (!req) {
+            // no smaller batch to execute the requests with, executing each with batch1
+            for (; n < numRequests; n++) {
+                auto& t = tasks[n];
+                t.first->_inferRequestWithoutBatch->SetCallback([&t, &completeTask](std::exception_ptr p) {
+                    if (p)
+                        t.first->_inferRequest->_exceptionPtr = p;
+                    completeTask(t.second);
+                });
+                t.first->_inferRequest->_wasBatchedRequestUsed =
+                    AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                _numBatch1Requests++;
+                try {
+                    t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+                    t.first->_inferRequestWithoutBatch->StartAsync();
+                } catch (...) {
+                    // the callback is not called, the request is completed with the exception
+                    t.first->_inferRequest->_exceptionPtr = std::current_exception();
+                    completeTask(t.second);
+                }
+            }
+            break;
+        }
+        // the partial batch is executed at once, the slots beyond the collected requests are not used
+        const int first = n;
+        const int last = std::min(numRequests, n + batchSize);
+        try {
+            for (; n < last; n++) {
+                auto inferRequest = tasks[n].first->_inferRequest;
+                inferRequest->CopyInputsToPartialRequest(*req, n - first, batchSize);
+                inferRequest->_inferRequestPartial = *req;
+                inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+            }
+            (*req)->SetCallback([&tasks, req, &completeTask, first, last, batchSize](std::exception_ptr p) {
+                for (int i = first; i < last; i++) {
+                    auto& t = tasks[i];
+                    if (p)
+                        t.first->_inferRequest->_exceptionPtr = p;
+                    else
+                        t.first->_inferRequest->CopyOutputsFromPartialRequest(*req, i - first, batchSize);
+                    completeTask(t.second);
+                }
+            });
+            _numPartialBatches++;
+            (*req)->StartAsync();
+        } catch (...) {
+            // the callback is not called, the requests of the batch are completed with the exception
+            const auto exception = std::current_exception();
+            for (int i = first; i < last; i++) {
+                tasks[i].first->_inferRequest->_exceptionPtr = exception;
+                completeTask(tasks[i].second);
+            }
+            n = last;
+        }
+    }
+    all_completed_future.get();
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
     if (!_network) {
         auto res = _networkWithoutBatch->CreateInferRequest();
@@ -644,10 +818,23 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
                              {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+                              METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              AUTO_BATCH_OCCUPANCY,
+                              AUTO_BATCH_STATISTICS});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
                              {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+    } else if (name == AUTO_BATCH_OCCUPANCY) {
+        const uint64_t collections = _numCollections;
+        const uint64_t requests = _numCollectedRequests;
+        const float occupancy =
+            collections ? static_cast<float>(requests) / (collections * std::max(1, _device.batchForDevice)) : 0.f;
+        return occupancy;
+    } else if (name == AUTO_BATCH_STATISTICS) {
+        return std::map<std::string, uint64_t>{{"full_batches", _numFullBatches.load()},
+                                               {"partial_batches", _numPartialBatches.load()},
+                                               {"batch1_requests", _numBatch1Requests.load()},
+                                               {"requests", _numCollectedRequests.load()}};
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -948,27 +1135,44 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    // the copy of the network to reshape, it is kept to load the smaller batches on demand
+    CNNNetwork clonedNetwork(InferenceEngine::details::cloneNetwork(network));
+    // the network doesn't own the core, the smaller batches can't be loaded after the core is destroyed
+    std::weak_ptr<ICore> weakCore = core;
+    auto loadNetworkWithBatch = [clonedNetwork, batched_inputs, ctx, weakCore, deviceName, deviceConfigNoAutoBatch](
+                                    int batch) {
+        auto core = weakCore.lock();
+        if (!core)
+            IE_THROW() << "The core is destroyed";
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(clonedNetwork));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
+    // the smaller batches (powers of two) to execute the partially collected batch when the timeout is over
+    // are loaded in the background when the partial batch of the size is collected for the first time
+    std::function<InferenceEngine::SoExecutableNetworkInternal(int)> loadNetworkWithPartialBatch;
+    if (executableNetworkWithBatch)
+        loadNetworkWithPartialBatch = loadNetworkWithBatch;
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        loadNetworkWithPartialBatch);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
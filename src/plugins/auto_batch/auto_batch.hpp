@@ -6,6 +6,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <map>
 #include <mutex>
 #include <string>
@@ -23,6 +26,12 @@ namespace AutoBatchPlugin {
 
 using DeviceName = std::string;
 
+// the executable network metrics of the achieved batching:
+// the average share of the device batch filled with the requests (float in the [0, 1] range)
+static constexpr const char* AUTO_BATCH_OCCUPANCY = "AUTO_BATCH_OCCUPANCY";
+// the counters of the executions by the flavor (std::map<std::string, uint64_t>)
+static constexpr const char* AUTO_BATCH_STATISTICS = "AUTO_BATCH_STATISTICS";
+
 struct DeviceInformation {
     DeviceName deviceName;
     std::map<std::string, std::string> config;
@@ -36,6 +45,9 @@ public:
     struct WorkerInferRequest {
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
+        // the requests of the smaller batches executing the partially collected batch (by the batch size),
+        // created by the worker thread once the network with the batch is loaded
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _inferRequestsPartial;
         int _batchSize;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
@@ -43,6 +55,9 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // the requests arrival tracking for the adaptive timeout (steady clock, in us)
+        std::atomic<int64_t> _lastArrival = {0};
+        std::atomic<int64_t> _arrivalInterval = {0};
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -51,7 +66,8 @@ public:
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        std::function<InferenceEngine::SoExecutableNetworkInternal(int)> loadNetworkWithBatch = nullptr);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -69,10 +85,20 @@ public:
 
 protected:
     static unsigned int ParseTimeoutValue(const std::string&);
+    std::chrono::microseconds GetCollectionTimeout(const WorkerInferRequest& workerRequest) const;
+    void ExecutePartialBatch(WorkerInferRequest& workerRequest, int numRequests);
+    // the request of the worker with the smaller batch, null if the network with the batch is not loaded (yet)
+    InferenceEngine::SoIInferRequestInternal* GetPartialBatchRequest(WorkerInferRequest& workerRequest, int batch);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    // the networks with the smaller batches (powers of two) are loaded in the background on the first demand
+    std::function<InferenceEngine::SoExecutableNetworkInternal(int)> _loadNetworkWithBatch;
+    std::map<int, std::shared_future<InferenceEngine::SoExecutableNetworkInternal>> _networksWithPartialBatch;
+    std::mutex _networksWithPartialBatchMutex;
+    // serializes the loads, the destructor waits for the load in progress only
+    std::mutex _partialBatchLoadMutex;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -83,6 +109,13 @@ protected:
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
 
+    // batching statistics
+    std::atomic<uint64_t> _numCollections = {0};
+    std::atomic<uint64_t> _numCollectedRequests = {0};
+    std::atomic<uint64_t> _numFullBatches = {0};
+    std::atomic<uint64_t> _numPartialBatches = {0};
+    std::atomic<uint64_t> _numBatch1Requests = {0};
+
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
 };
@@ -109,16 +142,25 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // Batch-Device impl specific: copies the data to/from the slot of the request executing the partial batch
+    void CopyInputsToPartialRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batchSize);
+    void CopyOutputsFromPartialRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    InferenceEngine::SoIInferRequestInternal _inferRequestPartial;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
@@ -512,8 +512,9 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     for (auto&& network : _networks) {
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
         metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        _heteroPlugin->BindStageToNumaNode(network._device, _config, metaDevices[network._device]);
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
-                                                                 network._device,
+                                                                 _heteroPlugin->GetStageDevice(network._device),
                                                                  metaDevices[network._device]);
     }
 }
@@ -568,12 +569,14 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
         auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, importedConfigs);
         assert(metaDevices.size() == 1);
         auto& loadConfig = metaDevices[deviceName];
+        _heteroPlugin->BindStageToNumaNode(deviceName, importedConfigs, loadConfig);
+        const auto stageDevice = _heteroPlugin->GetStageDevice(deviceName);
 
         InferenceEngine::SoExecutableNetworkInternal executableNetwork;
         CNNNetwork cnnnetwork;
         bool loaded = false;
-        if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(deviceName)) {
-            executableNetwork = _heteroPlugin->GetCore()->ImportNetwork(heteroModel, deviceName, loadConfig);
+        if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(stageDevice)) {
+            executableNetwork = _heteroPlugin->GetCore()->ImportNetwork(heteroModel, stageDevice, loadConfig);
         } else {
             // read XML content
             std::string xmlString;
@@ -609,7 +612,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
                 outputs[outputName]->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
             }
 
-            executableNetwork = _heteroPlugin->GetCore()->LoadNetwork(cnnnetwork, deviceName, loadConfig);
+            executableNetwork = _heteroPlugin->GetCore()->LoadNetwork(cnnnetwork, stageDevice, loadConfig);
             loaded = true;
         }
 
@@ -774,7 +777,7 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
     heteroModel << std::endl;
 
     for (auto&& subnetwork : _networks) {
-        if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(subnetwork._device)) {
+        if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(_heteroPlugin->GetStageDevice(subnetwork._device))) {
             subnetwork._network->Export(heteroModel);
         } else {
             auto subnet = subnetwork._clonedNetwork;
@@ -853,6 +856,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(NUMA_PIPELINE)) {
+        // the networks exported before the option was added aren't split
+        auto it = _config.find(name);
+        result = it != _config.end() && it->second == YES;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -933,6 +940,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(NUMA_PIPELINE),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -954,10 +962,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // the subgraphs of the consecutive requests run in parallel, so each subgraph needs its own requests in flight
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else {
@@ -0,0 +1,149 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_pipeline.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "ngraph/op/util/op_types.hpp"
+
+namespace HeteroPlugin {
+
+namespace {
+
+bool isSplitOp(const ngraph::Node* node) {
+    return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+}
+
+}  // namespace
+
+std::map<std::string, size_t> SplitIntoStages(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                                              const std::map<std::string, double>& latencies,
+                                              size_t stagesNumber,
+                                              double bytesPerMicrosecond) {
+    std::vector<ngraph::Node*> ops;
+    std::unordered_map<const ngraph::Node*, size_t> opIndices;
+    for (auto&& node : orderedOps) {
+        if (isSplitOp(node.get())) {
+            opIndices.emplace(node.get(), ops.size());
+            ops.push_back(node.get());
+        }
+    }
+    const size_t opsNumber = ops.size();
+    if (opsNumber == 0 || stagesNumber == 0) {
+        return {};
+    }
+
+    // latencies[begin, end) = prefix[end] - prefix[begin]
+    std::vector<double> prefix(opsNumber + 1, 0.);
+    for (size_t i = 0; i < opsNumber; i++) {
+        auto itLatency = latencies.find(ops[i]->get_friendly_name());
+        prefix[i + 1] = prefix[i] + (itLatency != latencies.end() ? itLatency->second : 0.);
+    }
+
+    // the time to pass the tensors produced before the cut and consumed after it, the cut i is before the operation i
+    std::vector<double> cutTime(opsNumber + 1, 0.);
+    {
+        std::vector<double> delta(opsNumber + 2, 0.);
+        for (size_t i = 0; i < opsNumber; i++) {
+            for (auto&& output : ops[i]->outputs()) {
+                size_t lastConsumer = i;
+                for (auto&& input : output.get_target_inputs()) {
+                    auto itIndex = opIndices.find(input.get_node());
+                    if (itIndex != opIndices.end()) {
+                        lastConsumer = std::max(lastConsumer, itIndex->second);
+                    }
+                }
+                if (lastConsumer == i || output.get_partial_shape().is_dynamic()) {
+                    continue;
+                }
+                const auto bytes = ngraph::shape_size(output.get_shape()) * output.get_element_type().size();
+                const auto time = static_cast<double>(bytes) / bytesPerMicrosecond;
+                delta[i + 1] += time;
+                delta[lastConsumer + 1] -= time;
+            }
+        }
+        double time = 0.;
+        for (size_t cut = 1; cut <= opsNumber; cut++) {
+            time += delta[cut];
+            cutTime[cut] = time;
+        }
+    }
+
+    // the furthest end of the stage starting at the cut within the time limit, the begin if there is no such end
+    auto stageEnd = [&](size_t begin, double limit) {
+        const double threshold = prefix[begin] + limit - cutTime[begin];
+        auto itEnd = std::upper_bound(prefix.begin() + begin + 1, prefix.end(), threshold);
+        return static_cast<size_t>(itEnd - prefix.begin()) - 1;
+    };
+
+    // reached[k][cut] is true if the operations before the cut are split into k stages or less within the limit
+    std::vector<std::vector<bool>> reached;
+    auto split = [&](double limit) {
+        reached.assign(1, std::vector<bool>(opsNumber + 1, false));
+        reached[0][0] = true;
+        for (size_t stage = 0; stage < stagesNumber; stage++) {
+            std::vector<int> cover(opsNumber + 2, 0);
+            for (size_t begin = 0; begin < opsNumber; begin++) {
+                if (!reached[stage][begin]) {
+                    continue;
+                }
+                const auto end = stageEnd(begin, limit);
+                if (end > begin) {
+                    cover[begin + 1]++;
+                    cover[end + 1]--;
+                }
+            }
+            auto next = reached[stage];
+            int covered = 0;
+            for (size_t cut = 1; cut <= opsNumber; cut++) {
+                covered += cover[cut];
+                next[cut] = next[cut] || covered > 0;
+            }
+            reached.push_back(std::move(next));
+            if (reached.back()[opsNumber]) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // the single stage always fits the total latency
+    double low = 0.;
+    double high = prefix[opsNumber];
+    const size_t searchSteps = 64;
+    for (size_t step = 0; step < searchSteps; step++) {
+        const double limit = (low + high) / 2;
+        if (split(limit)) {
+            high = limit;
+        } else {
+            low = limit;
+        }
+    }
+    split(high);
+
+    // restore the stages from the last one
+    std::vector<size_t> stageBegins;
+    for (size_t end = opsNumber, stage = reached.size() - 1; end != 0; stage--) {
+        size_t begin = 0;
+        while (!reached[stage - 1][begin] || stageEnd(begin, high) < end) {
+            begin++;
+        }
+        stageBegins.push_back(begin);
+        end = begin;
+    }
+    std::reverse(stageBegins.begin(), stageBegins.end());
+
+    std::map<std::string, size_t> stages;
+    for (size_t stage = 0; stage < stageBegins.size(); stage++) {
+        const auto end = stage + 1 < stageBegins.size() ? stageBegins[stage + 1] : opsNumber;
+        for (size_t i = stageBegins[stage]; i < end; i++) {
+            stages.emplace(ops[i]->get_friendly_name(), stage);
+        }
+    }
+    return stages;
+}
+
+}  // namespace HeteroPlugin
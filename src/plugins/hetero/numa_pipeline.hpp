@@ -0,0 +1,33 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/node.hpp"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Splits the operations into the consecutive pipeline stages, so the stage of the operation is never earlier
+ * than the stages of its inputs. The time of the stage is the latency of its operations plus the time to receive the
+ * tensors alive at the start of the stage, the split minimizes the longest stage time.
+ * @param orderedOps The operations in the topological order
+ * @param latencies The profiled latencies of the operations in microseconds by the friendly names, the missing
+ * operations (e.g. fused into the others) take no time
+ * @param stagesNumber The maximal number of the stages
+ * @param bytesPerMicrosecond The bandwidth of the interconnect between the stages
+ * @return The stage of each operation by the friendly name, the parameters, constants and results are not split and
+ * follow the operations connected to them
+ */
+std::map<std::string, size_t> SplitIntoStages(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                                              const std::map<std::string, double>& latencies,
+                                              size_t stagesNumber,
+                                              double bytesPerMicrosecond);
+
+}  // namespace HeteroPlugin
@@ -12,8 +12,14 @@
 #include <utility>
 #include <fstream>
 #include <unordered_set>
+#include <algorithm>
 #include "ie_plugin_config.hpp"
 #include "executable_network.hpp"
+#include "numa_pipeline.hpp"
+#include "ie_system_conf.h"
+#include "ie_algorithm.hpp"
+#include <cstdint>
+#include <cstring>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <openvino/runtime/properties.hpp>
 // clang-format on
@@ -27,6 +33,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(NUMA_PIPELINE)] = NO;
 }
 
 namespace {
@@ -40,6 +47,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(NUMA_PIPELINE),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -47,6 +55,14 @@ const std::vector<std::string>& getSupportedConfigKeys() {
     return supported_configKeys;
 }
 
+// the typical bandwidth of the link between the sockets, ~20 GB/s
+constexpr double interSocketBytesPerMicrosecond = 20000.;
+
+bool isNumaPipeline(const Engine::Configs& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(NUMA_PIPELINE));
+    return it != config.end() && it->second == YES;
+}
+
 }  // namespace
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork& network,
@@ -105,6 +121,88 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
     return metaDevices;
 }
 
+std::string Engine::GetStageDevice(const std::string& affinity) const {
+    DeviceIDParser deviceParser(affinity);
+    const auto deviceName = deviceParser.getDeviceName();
+    if (deviceParser.getDeviceID().empty()) {
+        return affinity;
+    }
+    const auto availableDevices =
+        GetCore()->GetMetric(deviceName, METRIC_KEY(AVAILABLE_DEVICES)).as<std::vector<std::string>>();
+    const bool enumeratesDevices =
+        std::any_of(availableDevices.begin(), availableDevices.end(), [](const std::string& id) {
+            return !id.empty();
+        });
+    return enumeratesDevices ? affinity : deviceName;
+}
+
+void Engine::BindStageToNumaNode(const std::string& affinity, const Configs& config, Configs& deviceConfig) const {
+    if (!isNumaPipeline(config) || GetStageDevice(affinity) == affinity) {
+        return;
+    }
+    deviceConfig[KEY_CPU_BIND_THREAD] = NUMA;
+    deviceConfig[CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID)] = DeviceIDParser(affinity).getDeviceID();
+}
+
+void Engine::SplitIntoNumaStages(const CNNNetwork& network,
+                                 const std::string& deviceName,
+                                 const Configs& deviceConfig,
+                                 QueryNetworkResult& queryResult) const {
+    const auto numaNodes = getAvailableNUMANodes();
+    if (numaNodes.size() < 2) {
+        return;
+    }
+    const auto stageDevice = [&](size_t stage) {
+        return deviceName + "." + std::to_string(numaNodes[stage]);
+    };
+    if (GetStageDevice(stageDevice(0)) != deviceName) {
+        IE_THROW() << HETERO_CONFIG_KEY(NUMA_PIPELINE) << " doesn't support the device " << deviceName;
+    }
+    auto function = network.getFunction();
+    if (function->is_dynamic()) {
+        IE_THROW() << HETERO_CONFIG_KEY(NUMA_PIPELINE) << " supports only the networks with static shapes";
+    }
+
+    // the latencies of the layers are profiled on the zero inputs, the first inference warms up
+    auto profilingConfig = deviceConfig;
+    profilingConfig[KEY_PERF_COUNT] = YES;
+    profilingConfig[CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE)] = "";
+    auto executableNetwork = GetCore()->LoadNetwork(network, deviceName, profilingConfig);
+    auto request = executableNetwork->CreateInferRequest();
+    for (auto&& input : executableNetwork->GetInputsInfo()) {
+        auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+        IE_ASSERT(blob != nullptr);
+        std::memset(blob->wmap().as<std::uint8_t*>(), 0, blob->byteSize());
+    }
+    std::map<std::string, double> latencies;
+    const size_t profilingInferences = 4;
+    for (size_t inference = 0; inference < profilingInferences; inference++) {
+        request->Infer();
+        if (inference == 0) {
+            continue;
+        }
+        for (auto&& layer : request->GetPerformanceCounts()) {
+            const auto latency = static_cast<double>(layer.second.realTime_uSec);
+            auto itLatency = latencies.find(layer.first);
+            if (itLatency == latencies.end()) {
+                latencies.emplace(layer.first, latency);
+            } else {
+                itLatency->second = std::min(itLatency->second, latency);
+            }
+        }
+    }
+
+    const auto stages =
+        SplitIntoStages(function->get_ordered_ops(), latencies, numaNodes.size(), interSocketBytesPerMicrosecond);
+    std::map<std::string, std::string> supportedLayersMap;
+    for (auto&& stage : stages) {
+        if (InferenceEngine::details::contains(queryResult.supportedLayersMap, stage.first)) {
+            supportedLayersMap.emplace(stage.first, stageDevice(stage.second));
+        }
+    }
+    queryResult.supportedLayersMap = std::move(supportedLayersMap);
+}
+
 void Engine::SetConfig(const Configs& configs) {
     for (auto&& kvp : configs) {
         const auto& name = kvp.first;
@@ -155,6 +253,14 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
         }
     }
 
+    if (isNumaPipeline(tconfig)) {
+        if (fallbackDevices.size() != 1) {
+            IE_THROW() << HETERO_CONFIG_KEY(NUMA_PIPELINE) << " requires the single device in the '"
+                       << ov::device::priorities.name() << "' option";
+        }
+        SplitIntoNumaStages(network, fallbackDevices.front(), metaDevices[fallbackDevices.front()], qr);
+    }
+
     // set OK status
     qr.rc = StatusCode::OK;
 
@@ -219,6 +325,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(NUMA_PIPELINE)) {
+        return {isNumaPipeline(_config)};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
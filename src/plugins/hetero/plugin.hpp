@@ -46,8 +46,24 @@ public:
 
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback, const Configs& localConfig) const;
 
+    /**
+     * @brief Returns the device to load the subgraph with the given affinity on. The ID of the device which doesn't
+     * enumerate its devices (e.g. CPU.0, CPU.1) only tags the pipeline stage, so one device can run several stages.
+     */
+    std::string GetStageDevice(const std::string& affinity) const;
+
+    /**
+     * @brief Binds the streams of the stage to the NUMA node tagged by the stage affinity (e.g. CPU.1) if the network
+     * is split into the NUMA pipeline
+     */
+    void BindStageToNumaNode(const std::string& affinity, const Configs& config, Configs& deviceConfig) const;
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string& deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
+    void SplitIntoNumaStages(const InferenceEngine::CNNNetwork& network,
+                             const std::string& deviceName,
+                             const Configs& deviceConfig,
+                             InferenceEngine::QueryNetworkResult& queryResult) const;
 };
 }  // namespace HeteroPlugin
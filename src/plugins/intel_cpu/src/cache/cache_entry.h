@@ -4,8 +4,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "lru_cache.h"
 
 namespace ov {
@@ -70,5 +75,109 @@ public:
     ImplType _impl;
 };
 
+/**
+ * @brief Thread safe version of the CacheEntry. The records are distributed between several shards by the key hash, each shard is an
+ *        independent LRU cache guarded by its own mutex, so threads working with different keys rarely contend.
+ *        Concurrent requests of the same missing key are deduplicated: only one thread calls the builder, the others wait for its result.
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The capacity is split evenly between the shards.
+ */
+
+template<typename KeyType,
+         typename ValType>
+class ConcurrentCacheEntry : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+public:
+    ConcurrentCacheEntry(size_t capacity, size_t shardsNum) : _capacity(capacity) {
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, capacity));
+        const size_t shardCapacity = capacity ? (capacity + shardsNum - 1) / shardsNum : 0;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
+     *        the underlying storage. If the same key is being built by another thread, waits for that result instead of building it again.
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+     */
+
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _capacity) {
+            // fast track
+            return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+        }
+
+        auto& shard = *_shards[key.hash() % _shards.size()];
+        const auto retEmpty = ValType();
+        std::promise<ValType> promise;
+        std::shared_future<ValType> pending;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            ValType retVal = shard.cache.get(key);
+            if (retVal != retEmpty) {
+                return {retVal, LookUpStatus::Hit};
+            }
+            auto itr = shard.inFlight.find(key);
+            if (itr != shard.inFlight.end()) {
+                pending = itr->second;
+            } else {
+                shard.inFlight.emplace(key, promise.get_future().share());
+            }
+        }
+
+        if (pending.valid()) {
+            // the value is being built by another thread, so from the point of view of this thread it is a hit
+            return {pending.get(), LookUpStatus::Hit};
+        }
+
+        ValType retVal;
+        try {
+            retVal = builder(key);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.inFlight.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (retVal != retEmpty)
+                shard.cache.put(key, retVal);
+            shard.inFlight.erase(key);
+        }
+        promise.set_value(retVal);
+        return {retVal, LookUpStatus::Miss};
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const KeyType &k) const {
+            return k.hash();
+        }
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+
+        std::mutex mutex;
+        LruCache<KeyType, ValType> cache;
+        std::unordered_map<KeyType, std::shared_future<ValType>, key_hasher> inFlight;
+    };
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
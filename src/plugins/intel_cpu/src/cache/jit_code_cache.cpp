@@ -0,0 +1,342 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_code_cache.h"
+
+#include <cstring>
+#include <sstream>
+#include <istream>
+#include <ostream>
+
+#include <ie_common.h>
+#include <ie_cache_manager.hpp>
+#include <openvino/core/version.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr uint32_t blobMagic = 0x434a564f;  // "OVJC"
+constexpr uint32_t blobVersion = 1;
+
+struct BlobHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t keySize;
+    uint64_t codeSize;
+    uint64_t relocationsNum;
+    uint64_t checksum;
+};
+
+// FNV-1a, the result must be the same in all the processes, so std::hash can not be used
+uint64_t fnv1a(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ull) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+uint64_t load64(const uint8_t* ptr) {
+    uint64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+void store64(uint8_t* ptr, uint64_t value) {
+    std::memcpy(ptr, &value, sizeof(value));
+}
+
+size_t pageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/**
+ * The 64-bit values which are stored by the code in "mov r64, imm64" instructions are checked against the external pointers.
+ * A pointer can be embedded into the code only as a 64-bit immediate if all the code and data of the process live above 4GB,
+ * otherwise it could be encoded as a 32-bit immediate, which is indistinguishable from a constant.
+ */
+bool processAddressesAbove4GB() {
+    static const bool result = [] {
+        const auto limit = static_cast<uintptr_t>(0xffffffffu);
+        std::unique_ptr<char[]> heap(new char[1]);
+        const auto code = reinterpret_cast<uintptr_t>(&processAddressesAbove4GB);
+        const auto data = reinterpret_cast<uintptr_t>(&blobMagic);
+        const auto stack = reinterpret_cast<uintptr_t>(&heap);
+        return code > limit && data > limit && stack > limit && reinterpret_cast<uintptr_t>(heap.get()) > limit;
+    }();
+    return result;
+}
+
+bool looksLikePointer(uint64_t value) {
+    // canonical user space addresses above 4GB
+    return value > 0xffffffffull && value < (1ull << 47);
+}
+
+bool isMovImm64(const uint8_t* code) {
+    // REX.W prefix (0x48 - 0x4F) followed by the "mov r64, imm64" opcode (0xB8 - 0xBF)
+    return (code[0] & 0xf8) == 0x48 && (code[1] & 0xf8) == 0xb8;
+}
+
+/**
+ * Compares two copies of the code generated at different addresses.
+ * @param relocations receives offsets of the absolute addresses pointing inside the code
+ * @return false if the code is not relocatable
+ */
+bool findRelocations(const uint8_t* code, const uint8_t* replica, size_t size, std::vector<uint64_t>& relocations) {
+    constexpr size_t immOffset = 2;
+    constexpr size_t instructionSize = immOffset + sizeof(uint64_t);
+
+    const auto base = reinterpret_cast<uint64_t>(code);
+    const auto replicaBase = reinterpret_cast<uint64_t>(replica);
+    std::vector<bool> explained(size, false);
+
+    for (size_t i = 0; i + instructionSize <= size; i++) {
+        if (!isMovImm64(code + i))
+            continue;
+        const auto value = load64(code + i + immOffset);
+        const auto replicaValue = load64(replica + i + immOffset);
+        if (value >= base && value - base <= size && replicaValue - replicaBase == value - base) {
+            relocations.push_back(i + immOffset);
+            std::fill(explained.begin() + i + immOffset, explained.begin() + i + instructionSize, true);
+            i += instructionSize - 1;
+        } else if (value == replicaValue && looksLikePointer(value)) {
+            // external absolute address, it is not valid in another process
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        if (code[i] != replica[i] && !explained[i])
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+JitCode::JitCode(std::shared_ptr<Generator> generator)
+    : _generator(std::move(generator)),
+      _code(_generator->jit_ker()),
+      _size(_generator->getSize()) {}
+
+JitCode::JitCode(const uint8_t* code, size_t size, const std::vector<uint64_t>& relocations) : _size(size) {
+    const auto page = pageSize();
+    const auto mappingSize = (size + page - 1) / page * page;
+#ifdef _WIN32
+    auto mapping = VirtualAlloc(nullptr, mappingSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (mapping == nullptr)
+        IE_THROW() << "Cannot allocate memory for the JIT code";
+#else
+    auto mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        IE_THROW() << "Cannot allocate memory for the JIT code";
+#endif
+    // the mapping is released by the member destructor if the constructor throws below
+    _mapping = std::unique_ptr<void, MappingDeleter>(mapping, MappingDeleter{mappingSize});
+
+    auto dst = static_cast<uint8_t*>(mapping);
+    std::memcpy(dst, code, size);
+    const auto base = reinterpret_cast<uint64_t>(dst);
+    for (const auto offset : relocations) {
+        store64(dst + offset, base + load64(dst + offset));
+    }
+
+#ifdef _WIN32
+    DWORD oldProtect;
+    const bool protectedOk = VirtualProtect(mapping, mappingSize, PAGE_EXECUTE_READ, &oldProtect) != 0;
+    if (protectedOk)
+        FlushInstructionCache(GetCurrentProcess(), mapping, mappingSize);
+#else
+    const bool protectedOk = mprotect(mapping, mappingSize, PROT_READ | PROT_EXEC) == 0;
+#endif
+    if (!protectedOk)
+        IE_THROW() << "Cannot make the JIT code executable";
+    _code = dst;
+}
+
+void JitCode::MappingDeleter::operator()(void* mapping) const {
+#ifdef _WIN32
+    VirtualFree(mapping, 0, MEM_RELEASE);
+#else
+    munmap(mapping, size);
+#endif
+}
+
+JitCodeCache::JitCodeCache(const std::string& cacheDir)
+    : _cacheManager(std::make_shared<InferenceEngine::FileStorageCacheManager>(cacheDir)) {}
+
+JitCodeCache::Ptr JitCodeCache::get(const std::string& cacheDir) {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (cacheDir.empty() || !processAddressesAbove4GB())
+        return nullptr;
+
+    static std::mutex instancesMutex;
+    static std::unordered_map<std::string, std::weak_ptr<JitCodeCache>> instances;
+
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    auto instance = instances[cacheDir].lock();
+    if (!instance) {
+        instance = std::make_shared<JitCodeCache>(cacheDir);
+        instances[cacheDir] = instance;
+    }
+    return instance;
+#else
+    return nullptr;
+#endif
+}
+
+std::string JitCodeCache::makeFullKey(const std::string& key) const {
+    std::ostringstream fullKey;
+    fullKey << ov::get_openvino_version().buildNumber
+            << "_isa" << static_cast<uint64_t>(dnnl::impl::cpu::x64::get_max_cpu_isa())
+            << "_" << key;
+    return fullKey.str();
+}
+
+JitCodePtr JitCodeCache::getOrCreate(const std::string& key, const GeneratorFactory& factory) {
+    if (key.empty())
+        return std::make_shared<JitCode>(factory());
+
+    const auto fullKey = makeFullKey(key);
+    if (auto code = load(fullKey))
+        return code;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_notStored.count(fullKey))
+            return std::make_shared<JitCode>(factory());
+    }
+    return store(fullKey, factory);
+}
+
+JitCodePtr JitCodeCache::load(const std::string& fullKey) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto itr = _loaded.find(fullKey);
+    if (itr != _loaded.end()) {
+        if (auto code = itr->second.lock())
+            return code;
+    }
+
+    JitCodePtr result;
+    const auto blobId = "cpu_jit_" + std::to_string(fnv1a(fullKey.data(), fullKey.size()));
+    _cacheManager->readCacheEntry(blobId, [&](std::istream& stream) {
+        const auto begin = stream.tellg();
+        stream.seekg(0, std::ios::end);
+        const auto end = stream.tellg();
+        stream.seekg(begin);
+        if (begin == std::streampos(-1) || end == std::streampos(-1) || end < begin)
+            return;
+        const auto blobSize = static_cast<uint64_t>(end - begin);
+
+        BlobHeader header{};
+        if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.magic != blobMagic || header.version != blobVersion || header.keySize != fullKey.size())
+            return;
+        // the sizes are not covered by the checksum yet, so they are checked against the blob size before the allocation
+        const auto payloadSize = blobSize - sizeof(header);
+        if (header.codeSize > payloadSize || header.relocationsNum > payloadSize / sizeof(uint64_t) ||
+            header.keySize + header.codeSize + header.relocationsNum * sizeof(uint64_t) != payloadSize)
+            return;
+
+        std::string key(header.keySize, '\0');
+        std::vector<uint64_t> relocations(header.relocationsNum);
+        std::vector<uint8_t> code(header.codeSize);
+        stream.read(&key[0], key.size());
+        stream.read(reinterpret_cast<char*>(relocations.data()), relocations.size() * sizeof(uint64_t));
+        stream.read(reinterpret_cast<char*>(code.data()), code.size());
+        // the blob may be truncated if it is being written by another process
+        if (!stream || key != fullKey || code.empty())
+            return;
+
+        auto checksum = fnv1a(key.data(), key.size());
+        checksum = fnv1a(relocations.data(), relocations.size() * sizeof(uint64_t), checksum);
+        checksum = fnv1a(code.data(), code.size(), checksum);
+        if (checksum != header.checksum)
+            return;
+        for (const auto offset : relocations) {
+            if (offset + sizeof(uint64_t) > code.size())
+                return;
+        }
+
+        result = std::make_shared<JitCode>(code.data(), code.size(), relocations);
+    });
+
+    if (result)
+        _loaded[fullKey] = result;
+    return result;
+}
+
+JitCodePtr JitCodeCache::store(const std::string& fullKey, const GeneratorFactory& factory) {
+    auto generated = std::make_shared<JitCode>(factory());
+    auto notStored = [&] {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _notStored.insert(fullKey);
+        return generated;
+    };
+    if (generated->size() == 0)
+        return notStored();
+
+    std::vector<uint64_t> relocations;
+    {
+        const JitCode replica(factory());
+        if (generated->size() != replica.size() ||
+            !findRelocations(generated->get(), replica.get(), generated->size(), relocations))
+            return notStored();
+    }
+
+    // the stored code keeps offsets from the beginning of the code instead of the absolute addresses
+    std::vector<uint8_t> code(generated->get(), generated->get() + generated->size());
+    const auto base = reinterpret_cast<uint64_t>(generated->get());
+    for (const auto offset : relocations) {
+        store64(code.data() + offset, load64(code.data() + offset) - base);
+    }
+
+    BlobHeader header{};
+    header.magic = blobMagic;
+    header.version = blobVersion;
+    header.keySize = fullKey.size();
+    header.codeSize = code.size();
+    header.relocationsNum = relocations.size();
+    header.checksum = fnv1a(fullKey.data(), fullKey.size());
+    header.checksum = fnv1a(relocations.data(), relocations.size() * sizeof(uint64_t), header.checksum);
+    header.checksum = fnv1a(code.data(), code.size(), header.checksum);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto blobId = "cpu_jit_" + std::to_string(fnv1a(fullKey.data(), fullKey.size()));
+    try {
+        _cacheManager->writeCacheEntry(blobId, [&](std::ostream& stream) {
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(fullKey.data(), fullKey.size());
+            stream.write(reinterpret_cast<const char*>(relocations.data()), relocations.size() * sizeof(uint64_t));
+            stream.write(reinterpret_cast<const char*>(code.data()), code.size());
+        });
+    } catch (...) {
+        // the cache directory is not writable, the generated code is still usable
+        _notStored.insert(fullKey);
+    }
+    return generated;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
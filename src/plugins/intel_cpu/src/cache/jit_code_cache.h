@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <cpu/x64/jit_generator.hpp>
+
+namespace InferenceEngine {
+class ICacheManager;
+}  // namespace InferenceEngine
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Executable code of a JIT kernel. The code is either owned by the generator which has created it,
+ *        or is a relocated copy of the code loaded from the persistent cache.
+ */
+class JitCode {
+public:
+    using Generator = dnnl::impl::cpu::x64::jit_generator;
+
+    explicit JitCode(std::shared_ptr<Generator> generator);
+    /**
+     * @brief Copies the code into a new executable memory region and patches the absolute addresses
+     * @param code pointer to the code bytes, where relocations hold offsets from the beginning of the code
+     * @param relocations offsets of the 64-bit absolute addresses inside the code
+     */
+    JitCode(const uint8_t* code, size_t size, const std::vector<uint64_t>& relocations);
+
+    JitCode(const JitCode&) = delete;
+    JitCode& operator=(const JitCode&) = delete;
+
+    const uint8_t* get() const noexcept {
+        return _code;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    bool isLoaded() const noexcept {
+        return _generator == nullptr;
+    }
+
+private:
+    struct MappingDeleter {
+        size_t size;
+        void operator()(void* mapping) const;
+    };
+
+    std::shared_ptr<Generator> _generator;
+    const uint8_t* _code = nullptr;
+    size_t _size = 0;
+    std::unique_ptr<void, MappingDeleter> _mapping;
+};
+
+using JitCodePtr = std::shared_ptr<const JitCode>;
+
+/**
+ * @brief Persistent cache of the JIT kernels code stored in the cache directory (CACHE_DIR).
+ *
+ * The kernel is identified by a key, which must describe everything the generated code depends on (kernel type, ISA, parameters).
+ * The cache adds the ISA of the machine and the build number to the key, so the code generated by another plugin build or
+ * on another CPU is never reused.
+ *
+ * Only relocatable code is stored. To prove it, the kernel is generated twice at different addresses and the two copies are compared:
+ * the only allowed differences are 64-bit absolute addresses pointing inside the code itself (e.g. addresses of the constant tables),
+ * they are stored as relocations. The code with any other difference (relative calls of external functions, addresses of
+ * external data) or with 64-bit immediates which look like external pointers is not stored and is used as is.
+ * The second copy is generated only by the first miss of the key in the process, the next misses (the code is not
+ * relocatable or the cache directory is not writable) generate the kernel once.
+ *
+ * @note The instance is shared between all the graphs of the process using the same cache directory and is thread safe.
+ */
+class JitCodeCache {
+public:
+    using Ptr = std::shared_ptr<JitCodeCache>;
+    using GeneratorFactory = std::function<std::shared_ptr<JitCode::Generator>()>;
+
+    explicit JitCodeCache(const std::string& cacheDir);
+
+    /**
+     * @brief Returns the cache instance for the directory
+     * @return nullptr if the persistent code cache is not supported on the platform
+     */
+    static Ptr get(const std::string& cacheDir);
+
+    /**
+     * @brief Loads the kernel code from the cache, or generates and stores it.
+     * @param key description of the kernel, empty key disables caching of the kernel
+     * @param factory creates and generates a new instance of the kernel
+     * @return executable code of the kernel, never nullptr
+     */
+    JitCodePtr getOrCreate(const std::string& key, const GeneratorFactory& factory);
+
+private:
+    std::string makeFullKey(const std::string& key) const;
+    JitCodePtr load(const std::string& fullKey);
+    JitCodePtr store(const std::string& fullKey, const GeneratorFactory& factory);
+
+    std::shared_ptr<InferenceEngine::ICacheManager> _cacheManager;
+    std::mutex _mutex;
+    // loaded code is shared by all the streams which create the same kernel
+    std::unordered_map<std::string, std::weak_ptr<const JitCode>> _loaded;
+    // the keys which have failed to be stored
+    std::unordered_set<std::string> _notStored;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
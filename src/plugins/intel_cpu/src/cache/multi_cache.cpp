@@ -9,5 +9,8 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::MultiCache(const MultiCache& other)
+    : _capacity(other._capacity), _threadSafe(other._threadSafe), _shardsNum(other._shardsNum), _storage(other._storage) {}
+
 }   // namespace intel_cpu
 }   // namespace ov
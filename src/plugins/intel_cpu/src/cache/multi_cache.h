@@ -7,6 +7,8 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <chrono>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,23 +17,45 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention The default implementation IS NOT THREAD SAFE! The thread safe mode (see the constructor parameters) uses sharded
+ *            entries and has to be used when one cache instance is shared between several streams.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = ConcurrentCacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
+    /**
+    * @brief Snapshot of the cache usage counters accumulated over all the entries
+    */
+    struct Statistics {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t buildTimeUs;
+    };
+
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe enables the thread safe mode, when the cache may be accessed concurrently
+    * @param shardsNum number of independently locked shards FOR EACH entry in the thread safe mode
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false, size_t shardsNum = 16)
+        : _capacity(capacity), _threadSafe(threadSafe), _shardsNum(shardsNum) {}
+
+    /**
+    * @brief The copy shares the entries with the original cache, including the entries created after the copy, while the
+    *        statistics counters of the copy start from zero. So the users sharing one thread safe cache may keep their own
+    *        counters.
+    */
+    MultiCache(const MultiCache& other);
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,20 +69,64 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        auto timedBuilder = [&](const KeyType& key) -> ValueType {
+            const auto start = std::chrono::steady_clock::now();
+            ValueType result = builder(key);
+            _buildTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            return result;
+        };
+
+        typename CacheEntry<KeyType, ValueType>::ResultType result;
+        if (_threadSafe) {
+            result = getEntry<ConcurrentEntryTypeT<KeyType, ValueType>>()->getOrCreate(key, timedBuilder);
+        } else {
+            result = getEntry<EntryTypeT<KeyType, ValueType>>()->getOrCreate(key, timedBuilder);
+        }
+
+        if (CacheEntryBase::LookUpStatus::Hit == result.second) {
+            _hits++;
+        } else {
+            _misses++;
+        }
+        return result;
+    }
+
+    Statistics getStatistics() const {
+        return {_hits.load(), _misses.load(), _buildTimeUs.load()};
+    }
+
+    bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
+    size_t getCapacity() const noexcept {
+        return _capacity;
     }
 
 private:
     template<typename T>
     size_t getTypeId();
+    template<typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
+    template<typename KeyType, typename ValueType>
+    EntryBasePtr makeEntry(EntryTypeT<KeyType, ValueType>*) const;
     template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    EntryBasePtr makeEntry(ConcurrentEntryTypeT<KeyType, ValueType>*) const;
 
 private:
+    struct Storage {
+        std::mutex mutex;
+        std::unordered_map<size_t, EntryBasePtr> entries;
+    };
+
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
-    std::unordered_map<size_t, EntryBasePtr> _storage;
+    bool _threadSafe;
+    size_t _shardsNum;
+    std::shared_ptr<Storage> _storage = std::make_shared<Storage>();
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _buildTimeUs{0};
 };
 
 template<typename T>
@@ -67,18 +135,32 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
-    auto itr = _storage.find(id);
-    if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+    std::unique_lock<std::mutex> lock(_storage->mutex, std::defer_lock);
+    if (_threadSafe) {
+        lock.lock();
+    }
+    auto& entries = _storage->entries;
+    auto itr = entries.find(id);
+    if (itr == entries.end()) {
+        auto result = entries.insert({id, makeEntry(static_cast<EntryType*>(nullptr))});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
 }
 
+template<typename KeyType, typename ValueType>
+MultiCache::EntryBasePtr MultiCache::makeEntry(EntryTypeT<KeyType, ValueType>*) const {
+    return std::make_shared<EntryTypeT<KeyType, ValueType>>(_capacity);
+}
+
+template<typename KeyType, typename ValueType>
+MultiCache::EntryBasePtr MultiCache::makeEntry(ConcurrentEntryTypeT<KeyType, ValueType>*) const {
+    return std::make_shared<ConcurrentEntryTypeT<KeyType, ValueType>>(_capacity, _shardsNum);
+}
+
 using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
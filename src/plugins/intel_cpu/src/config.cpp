@@ -148,6 +148,34 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING == key) {
+            if (val == "STREAM")
+                rtCacheSharing = RtCacheSharingMode::Stream;
+            else if (val == "NETWORK")
+                rtCacheSharing = RtCacheSharingMode::Network;
+            else if (val == "PLUGIN")
+                rtCacheSharing = RtCacheSharingMode::Plugin;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING
+                           << ". Expected only STREAM/NETWORK/PLUGIN";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_JIT_CODE_CACHE == key) {
+            if (val == PluginConfigParams::YES) jitCodeCache = true;
+            else if (val == PluginConfigParams::NO) jitCodeCache = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_JIT_CODE_CACHE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_COMPRESSED_WEIGHTS == key) {
+            if (val == PluginConfigParams::YES) compressedWeights = true;
+            else if (val == PluginConfigParams::NO) compressedWeights = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_COMPRESSED_WEIGHTS
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
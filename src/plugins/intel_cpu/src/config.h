@@ -22,12 +22,22 @@ struct Config {
         On,
     };
 
+    enum RtCacheSharingMode {
+        Stream,
+        Network,
+        Plugin,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    RtCacheSharingMode rtCacheSharing = RtCacheSharingMode::Stream;
+    bool parallelBranches = false;
+    bool jitCodeCache = true;
+    bool compressedWeights = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
@@ -189,6 +190,25 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     return sizeChanged;
 }
 
+bool MemoryMngrWithGrowth::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    if (size <= _memUpperBound)
+        return false;
+
+    const size_t capacity = std::max(size, 2 * _memUpperBound);
+    void *ptr = dnnl::impl::malloc(capacity, cacheLineSize);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    if (_data) {
+        cpu_memcpy(ptr, _data.get(), _memUpperBound);
+    }
+    _memUpperBound = capacity;
+    _useExternalStorage = false;
+    _data = decltype(_data)(ptr, destroy);
+    return true;
+}
+
 bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
     return _useExternalStorage;
 }
@@ -80,7 +80,7 @@ public:
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
 
-private:
+protected:
     bool _useExternalStorage = false;
     size_t _memUpperBound = 0ul;
     std::unique_ptr<void, void (*)(void *)> _data;
@@ -89,6 +89,16 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief An implementation of the mem manager which keeps the data on the reallocation. The capacity is at least
+ * doubled on each reallocation, so the sequential growth of the buffer (e.g. appending to a variable state) takes
+ * the amortized constant time per byte.
+ */
+class MemoryMngrWithGrowth : public MemoryMngrWithReuse {
+public:
+    bool resize(size_t size) override;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
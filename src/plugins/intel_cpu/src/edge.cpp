@@ -7,6 +7,7 @@
 #include "dnnl_extension_utils.h"
 #include <blob_factory.hpp>
 #include "nodes/input.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
 
 using namespace dnnl;
 namespace ov {
@@ -288,6 +289,34 @@ std::string Edge::name() const {
     return  result.str();
 }
 
+/**
+ * Describes the content of the constant edge memory, so the identical weights of different networks can share the memory.
+ * Only the constants and the reorders of the constants (packed weights) are described, the key is empty for other nodes.
+ */
+std::string Edge::contentKey() const {
+    auto parentPtr = getParent();
+    if (parentPtr->getType() == Type::Input) {
+        auto input = std::dynamic_pointer_cast<node::Input>(parentPtr);
+        return input ? input->getContentKey() : std::string();
+    }
+
+    // the reorder result depends only on the source data and the memory descriptors
+    if (parentPtr->getType() != Type::Reorder || parentPtr->getParentEdges().size() != 1)
+        return {};
+
+    auto parentEdge = parentPtr->getParentEdgeAt(0);
+    const auto parentKey = parentEdge->contentKey();
+    if (parentKey.empty())
+        return {};
+
+    auto descHash = [](const MemoryDesc& desc) {
+        const auto dnnlDesc = MemoryDescUtils::convertToDnnlMemoryDesc(desc.clone());
+        const auto& data = dnnlDesc->getDnnlDesc().data;
+        return WeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(&data), sizeof(data));
+    };
+    return parentKey + "_reorder_" + std::to_string(descHash(parentEdge->getDesc())) + "_" + std::to_string(descHash(getDesc()));
+}
+
 void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
     auto isInPlace = [](const NodePtr node, int port) -> bool {
         const auto& selected_pd = node->getSelectedPrimitiveDescriptor();
@@ -322,13 +351,17 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
-        memoryPtr = *ptr;
-        useExternalMemory = true;
-        status = Status::Allocated;
-    } else {
-        allocate();
+        auto ptr = weightsCache->findOrCreate(name(), [this] { return contentKey(); }, alloc, false);
+        MemoryPtr sharedMemory = *ptr;
+        // the preloaded memory (e.g. of an imported network) may not match the edge if the graph is compiled differently
+        if (sharedMemory->getDesc().isCompatible(getDesc())) {
+            memoryPtr = sharedMemory;
+            useExternalMemory = true;
+            status = Status::Allocated;
+            return;
+        }
     }
+    allocate();
 }
 
 void Edge::changeStatus(Edge::Status state) {
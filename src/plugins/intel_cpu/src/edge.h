@@ -81,6 +81,7 @@ public:
 
 private:
     std::string name() const;
+    std::string contentKey() const;
 
     std::weak_ptr<Node> parent;
     std::weak_ptr<Node> child;
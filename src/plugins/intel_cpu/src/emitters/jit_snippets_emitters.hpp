@@ -150,6 +150,8 @@ private:
 /// So previous_inc is zero for outer and vector tiles (the are the first in dim) and vlen for scalar tiles (they usually go after vector Tiles).
 /// \param      in[2]    sum number inputs and number of outputs of the node.
 /// \param      in[3]    dimension of the tile. Note that only 2d Tile are currently supported, so dim is 0 for outer tiles, 1 for inner tiles.
+/// \param      in[4]    optional bit mask of the data pointers to be returned to the beginning of the inner dimension after the tile.
+/// It is set for the last inner tile of a reduction stage if the following stages read the same data again.
 ///
 // Todo: Inner and outer tiles have different semantics. For example, outer tile always has the increment == 1, and it can contain only
 //  tile emitters (one outer or two inner). So it seems better to create different classes for inner and outer tiles.
@@ -180,8 +182,8 @@ public:
 private:
     void validate_arguments(const std::vector<size_t> &in, const std::vector<size_t> &out,
                             const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override {
-        if (in.size() != 4)
-            IE_THROW() << "TileEmitter got invalid number of inputs. Expected 4, got " << in.size();
+        if (in.size() != 4 && in.size() != 5)
+            IE_THROW() << "TileEmitter got invalid number of inputs. Expected 4 or 5, got " << in.size();
         if (out.size() != 0)
             IE_THROW() << "TileEmitter got unexpected output arguments.";
         const size_t num_params = in[2];
@@ -199,6 +201,18 @@ private:
                    const std::vector<size_t>& pool,
                    const std::vector<size_t>& gpr,
                    const ov::intel_cpu::emitter_context *emit_context) const override {
+        emit_tile(in, pool);
+        if (in.size() > 4) {
+            const size_t rewind_mask = in[4];
+            const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
+            for (size_t i = 0; i < in[2]; i++) {
+                if (rewind_mask & (size_t(1) << i))
+                    h->sub(Reg64(reg64_tmp_start + i), jcp.scheduler_dims[in[3]] * sizeof(float));
+            }
+        }
+    }
+
+    void emit_tile(const std::vector<size_t>& in, const std::vector<size_t>& pool) const {
         const size_t inc = in[0];
         const size_t previous_inc = in[1]; // increment of a previous tile in the same dim (0 if the first tile in the dim)
         const size_t num_params = in[2];
@@ -404,6 +418,184 @@ private:
     int32_t value;
 };
 
+///
+/// \brief    Accumulates the input into the output register lane-wise. The output register keeps its value during the whole
+/// reduction stage: it is initialized before the vector tile and its lanes are combined by HorizonReduceEmitter after the vector tile,
+/// then the scalar tile accumulates the tail by ScalarReduceEmitter.
+///
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto reduce = ov::as_type_ptr<ngraph::snippets::op::Reduce>(n);
+        if (!reduce)
+            IE_THROW() << "ReduceEmitter invoked with invalid op argument";
+        kind = reduce->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src0 = Vmm(in[0]);
+        Vmm vmm_acc = Vmm(out[0]);
+        if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src0);
+        else
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_src0);
+    }
+
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+///
+/// \brief    Accumulates the lane 0 of the input into the horizontally reduced accumulator. The scalar load fills the other lanes
+/// of the input with zeros, so the result is computed in the lane 0 and broadcasted to all the lanes.
+///
+class ScalarReduceEmitter : public jit_emitter {
+public:
+    ScalarReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto reduce = ov::as_type_ptr<ngraph::snippets::op::ScalarReduce>(n);
+        if (!reduce)
+            IE_THROW() << "ScalarReduceEmitter invoked with invalid op argument";
+        kind = reduce->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Xmm xmm_src0 = Xmm(in[0]);
+        Xmm xmm_acc = Xmm(out[0]);
+        if (isa == dnnl::impl::cpu::x64::sse41) {
+            if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+                h->maxss(xmm_acc, xmm_src0);
+            else
+                h->addss(xmm_acc, xmm_src0);
+        } else {
+            if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+                h->vmaxss(xmm_acc, xmm_acc, xmm_src0);
+            else
+                h->vaddss(xmm_acc, xmm_acc, xmm_src0);
+        }
+        h->uni_vbroadcastss(Vmm(out[0]), xmm_acc);
+    }
+
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+///
+/// \brief    Combines the lanes of a reduction accumulator, the result is broadcasted to all the lanes.
+///
+class HorizonReduceEmitter : public jit_emitter {
+public:
+    HorizonReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto horizon = ov::as_type_ptr<ngraph::snippets::op::HorizonReduce>(n);
+        if (!horizon)
+            IE_THROW() << "HorizonReduceEmitter invoked with invalid op argument";
+        kind = horizon->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src0 = Vmm(in[0]);
+        Vmm vmm_dst = Vmm(out[0]);
+        Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+        auto reduce = [&]() {
+            if (kind == ngraph::snippets::op::Reduce::Kind::Max)
+                h->uni_vmaxps(vmm_dst, vmm_dst, vmm_aux);
+            else
+                h->uni_vaddps(vmm_dst, vmm_dst, vmm_aux);
+        };
+
+        if (vmm_dst.getIdx() != vmm_src0.getIdx())
+            h->uni_vmovups(vmm_dst, vmm_src0);
+        // every step combines the lanes with the swapped halves of the current block, so the result appears in all the lanes
+        if (isa == dnnl::impl::cpu::x64::avx512_common) {
+            h->vshuff32x4(Zmm(vmm_aux.getIdx()), Zmm(vmm_dst.getIdx()), Zmm(vmm_dst.getIdx()), 0x4E);
+            reduce();
+            h->vshuff32x4(Zmm(vmm_aux.getIdx()), Zmm(vmm_dst.getIdx()), Zmm(vmm_dst.getIdx()), 0xB1);
+            reduce();
+        } else if (isa == dnnl::impl::cpu::x64::avx2) {
+            h->vperm2f128(Ymm(vmm_aux.getIdx()), Ymm(vmm_dst.getIdx()), Ymm(vmm_dst.getIdx()), 0x01);
+            reduce();
+        }
+        h->uni_vshufps(vmm_aux, vmm_dst, vmm_dst, 0x4E);
+        reduce();
+        h->uni_vshufps(vmm_aux, vmm_dst, vmm_dst, 0xB1);
+        reduce();
+    }
+
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
 ///
 /// Memory emitters:
 ///
@@ -440,7 +632,7 @@ protected:
 class StoreEmitter : public MemoryEmitter  {
 public:
     StoreEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -469,15 +661,23 @@ private:
                                     Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
         Vmm vmm_src0 = Vmm(in[0]);
+        // a reduced value is broadcasted to all the lanes, its only element is written to the same address during the row
+        if (!shouldPostIncrement) {
+            h->uni_vmovss(h->ptr[out_reg], Xmm(in[0]));
+            return;
+        }
         h->uni_vmovups(h->ptr[out_reg], vmm_src0);
         h->add(out_reg, dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
     }
+
+private:
+    bool shouldPostIncrement;
 };
 
 class ScalarStoreEmitter : public MemoryEmitter {
 public:
     ScalarStoreEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : MemoryEmitter(h, isa, n) {
+    : MemoryEmitter(h, isa, n), shouldPostIncrement(*n->get_input_shape(0).rbegin() != 1) {
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -507,8 +707,14 @@ private:
         Reg64 out_reg(ea);
         Xmm vmm_src0 = Xmm(in[0]);
         h->uni_vmovss(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, sizeof(float));
+        // a reduced value is stored once per row, so it is written to the same address during the row
+        if (shouldPostIncrement) {
+            h->add(out_reg, sizeof(float));
+        }
     }
+
+private:
+    bool shouldPostIncrement;
 };
 
 class LoadEmitter : public MemoryEmitter {
@@ -5,6 +5,7 @@
 #include <ie_metric_helpers.hpp>
 #include <precision_utils.h>
 #include "exec_network.h"
+#include "plugin.h"
 
 #include "async_infer_request.h"
 #include "infer_request.h"
@@ -24,6 +25,7 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -67,7 +69,8 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const std::unordered_map<std::string, MemoryPtr>& packedWeights) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
@@ -120,6 +123,25 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    switch (_cfg.rtCacheSharing) {
+    case Config::RtCacheSharingMode::Network:
+        _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+        break;
+    case Config::RtCacheSharingMode::Plugin:
+        if (auto engine = std::dynamic_pointer_cast<Engine>(plugin))
+            _rtParamsCache = engine->getSharedRuntimeCache(_cfg.rtCacheCapacity);
+        break;
+    default:
+        break;
+    }
+
+    // the imported memory is used in place by the first NUMA node, the other nodes make their own copies
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    for (const auto& weights : packedWeights) {
+        for (size_t i = 0; i < numaNodes.size(); i++)
+            _numaNodesWeights[numaNodes[i]]->preload(weights.first, weights.second, i != 0);
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -182,7 +204,7 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _rtParamsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -285,9 +307,42 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
     }
 }
 
+InferenceEngine::Parameter ExecNetwork::GetRuntimeCacheStatistics() const {
+    MultiCache::Statistics total{0, 0, 0};
+    auto accumulate = [&total](const MultiCacheCPtr& cache) {
+        if (!cache)
+            return;
+        const auto stats = cache->getStatistics();
+        total.hits += stats.hits;
+        total.misses += stats.misses;
+        total.buildTimeUs += stats.buildTimeUs;
+    };
+
+    if (_rtParamsCache) {
+        accumulate(_rtParamsCache);
+    } else {
+        for (auto& g : _graphs) {
+            auto graphLock = GraphGuard::Lock(g);
+            if (graphLock._graph.IsReady())
+                accumulate(graphLock._graph.GetRuntimeCache());
+        }
+    }
+
+    return std::map<std::string, uint64_t>{
+        {"HITS", total.hits},
+        {"MISSES", total.misses},
+        {"BUILD_TIME_US", total.buildTimeUs},
+    };
+}
+
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+
+    // must be handled before the graph of the current stream is locked, since the counters of all the graphs are collected
+    if (name == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_STATISTICS) {
+        return GetRuntimeCacheStatistics();
+    }
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -546,6 +601,9 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    PackedWeightsSerializer weightsSerializer(modelStream);
+    weightsSerializer << GetGraph()._graph;
 }
 
 }   // namespace intel_cpu
@@ -34,9 +34,13 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    /**
+     * @param packedWeights the weights packed by the exported network, they are taken by the graphs as is
+     */
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const std::unordered_map<std::string, MemoryPtr>& packedWeights = {});
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -68,6 +72,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                           _numaNodesWeights;
+    // runtime parameters cache shared between the streams, nullptr means that each stream graph has its own cache
+    MultiCachePtr                               _rtParamsCache;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -80,6 +86,8 @@ protected:
 
     bool isLegacyAPI() const;
 
+    InferenceEngine::Parameter GetRuntimeCacheStatistics() const;
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
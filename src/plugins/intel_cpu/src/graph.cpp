@@ -27,6 +27,7 @@
 #include "nodes/convert.h"
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -64,7 +65,7 @@ dnnl::engine Graph::eng(dnnl::engine::kind::cpu, 0);
 
 template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
-        WeightsSharing::Ptr &w_cache) {
+        WeightsSharing::Ptr &w_cache, const MultiCachePtr& rtCache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
 
     if (IsReady())
@@ -72,7 +73,14 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    if (rtCache) {
+        IE_ASSERT(rtCache->isThreadSafe());
+        rtParamsCache = rtCache;
+    } else {
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    }
+
+    jitCodeCache = config.jitCodeCache ? JitCodeCache::get(config.cache_dir) : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -115,9 +123,9 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 }
 
 template void Graph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const MultiCachePtr&);
 template void Graph::CreateGraph(const CNNNetwork&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const MultiCachePtr&);
 
 void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const ExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -150,6 +158,7 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const Ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setJitCodeCache(jitCodeCache);
 
         graphNodes.push_back(node);
 
@@ -262,6 +271,7 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setJitCodeCache(jitCodeCache);
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -392,6 +402,10 @@ void Graph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    parallelBranches = config.parallelBranches && CanExecuteBranchesInParallel();
+    if (parallelBranches)
+        InitExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -460,6 +474,78 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (parallelBranches) {
+        for (const auto& execNode : executableGraphNodes) {
+            const auto level = static_cast<size_t>(execLevels[execNode->execIndex]);
+            if (executableGraphLevels.size() <= level)
+                executableGraphLevels.resize(level + 1);
+            executableGraphLevels[level].emplace_back(execNode);
+        }
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<NodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
+
+    // The nodes are executed one by one, so they share a single scratch pad sized to the largest request.
+    // In the parallel branches mode the nodes of one level run at the same time and get different scratch pads.
+    std::vector<std::shared_ptr<IMemoryMngr>> scratchPads{std::make_shared<MemoryMngrWithReuse>()};
+    for (const auto& graphNode : graphNodes) {
+        graphNode->setScratchPad(scratchPads.front());
+    }
+    for (const auto& level : executableGraphLevels) {
+        for (size_t i = 1; i < level.size(); i++) {
+            if (scratchPads.size() <= i)
+                scratchPads.push_back(std::make_shared<MemoryMngrWithReuse>());
+            level[i]->setScratchPad(scratchPads[i]);
+        }
+    }
+}
+
+bool Graph::CanExecuteBranchesInParallel() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // dynamic nodes reallocate edge memory and use the runtime cache on each inference
+    return std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode();
+    });
+#else
+    // nested OpenMP regions are serialized, so node kernels would lose their own parallelism
+    return false;
+#endif
+}
+
+void Graph::InitExecutionLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitExecutionLevels");
+    // graphNodes are sorted topologically, so all parents are visited before their children
+    execLevels.assign(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (const auto& parentEdge : node->getParentEdges()) {
+            auto edge = parentEdge.lock();
+            if (!edge)
+                continue;
+            level = std::max(level, execLevels[edge->getParent()->execIndex] + 1);
+        }
+        execLevels[node->execIndex] = level;
+    }
+}
+
+int Graph::GetExecTimestamp(const NodePtr& node) const {
+    // In parallel branches mode all nodes of one level may run at the same time, so the edge
+    // live time is measured in levels. Otherwise memory of a node running concurrently could be reused.
+    return parallelBranches ? execLevels[node->execIndex] : node->execIndex;
+}
+
+std::vector<std::pair<std::string, MemoryPtr>> Graph::getPackedWeights() const {
+    std::vector<std::pair<std::string, MemoryPtr>> packedWeights;
+    for (const auto& edge : graphEdges) {
+        // the plain constants of the IR are already in the exported blob
+        if (edge->getParent()->getType() == Type::Input)
+            continue;
+        if (edge->isUseExternalMemory() && edge->getStatus() == Edge::Status::Allocated)
+            packedWeights.emplace_back(edge->name(), edge->getMemoryPtr());
+    }
+    return packedWeights;
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -694,8 +780,8 @@ void Graph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = GetExecTimestamp(edge->getParent());
+            int e_finish = GetExecTimestamp(edge->getChild());
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -958,18 +1044,77 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    dnnl::stream stream(eng);
+    if (parallelBranches) {
+        InferParallelBranches(request);
+    } else {
+        dnnl::stream stream(eng);
+
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
+    }
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (infer_count != -1) infer_count++;
+}
 
+void Graph::InferParallelBranches(InferRequestBase* request) {
+    auto wallTime = config.collectPerfCounters ? std::unique_ptr<PerfHelper>(new PerfHelper(parallelBranchesWallTime)) : nullptr;
+
+    dnnl::stream stream(eng);
+
+    for (const auto& level : executableGraphLevels) {
         if (request)
             request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+
+        if (level.size() == 1) {
+            const auto& node = level.front();
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // The nodes are spawned as tasks of the current stream arena, so the parallel loops
+        // inside the node kernels are served by the threads that are not busy with other branches.
+        InferenceEngine::parallel_for(level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteBranchNode(node);
+        });
     }
+}
 
-    if (infer_count != -1) infer_count++;
+namespace {
+// the node of the parallel branch executed by the current thread
+thread_local const Node* executingBranchNode = nullptr;
+}   // namespace
+
+void Graph::ExecuteBranchNode(const NodePtr& node) const {
+    // The nodes share the thread local state and the oneDNN scratchpad of the thread, so the node must not start
+    // on the thread which is waiting in the parallel loop of another node
+    if (executingBranchNode) {
+        IE_THROW() << "Node " << node->getName() << " is started on the thread executing the node "
+                   << executingBranchNode->getName();
+    }
+    struct BranchNodeGuard {
+        explicit BranchNodeGuard(const Node* node) { executingBranchNode = node; }
+        ~BranchNodeGuard() { executingBranchNode = nullptr; }
+    } guard(node.get());
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the threads waiting in the parallel loops of the node don't take the tasks of the other nodes
+    tbb::this_task_arena::isolate([&] {
+        ExecuteNode(node, dnnl::stream(eng));
+    });
+#else
+    ExecuteNode(node, dnnl::stream(eng));
+#endif
 }
 
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
@@ -1088,6 +1233,45 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
             continue;
         getPerfMapFor(perfMap, graphNodes[i]);
     }
+
+    if (parallelBranches && config.collectPerfCounters) {
+        // The summary record compares the serial time (sum of the node times), the measured wall time
+        // and the critical path of the graph, which is the lower bound for the wall time.
+        std::vector<uint64_t> finishTime(graphNodes.size(), 0);
+        uint64_t serialTime = 0;
+        uint64_t criticalPath = 0;
+        for (const auto& node : graphNodes) {
+            uint64_t startTime = 0;
+            for (const auto& parentEdge : node->getParentEdges()) {
+                auto edge = parentEdge.lock();
+                if (edge)
+                    startTime = std::max(startTime, finishTime[edge->getParent()->execIndex]);
+            }
+            const uint64_t nodeTime = node->isConstant() ? 0 : node->PerfCounter().avg();
+            finishTime[node->execIndex] = startTime + nodeTime;
+            serialTime += nodeTime;
+            criticalPath = std::max(criticalPath, finishTime[node->execIndex]);
+        }
+        const uint64_t wallTime = parallelBranchesWallTime.avg();
+
+        // share of the maximal possible saving (serial time minus critical path) which was really achieved
+        const uint64_t possibleSaving = serialTime > criticalPath ? serialTime - criticalPath : 0;
+        const uint64_t achievedSaving = serialTime > wallTime ? serialTime - wallTime : 0;
+        const uint64_t overlap = possibleSaving ? std::min<uint64_t>(100, achievedSaving * 100 / possibleSaving) : 0;
+
+        // The record is not a layer, so it has no times of its own and is not summed up with the layers by the tools.
+        // The times are reported in the exec type.
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["ParallelBranches"];
+        pc.execution_index = i++;
+        pc.cpu_uSec = pc.realTime_uSec = 0;
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        const std::string execType = "serial_" + std::to_string(serialTime) + "us_wall_" + std::to_string(wallTime) +
+                                     "us_critical_path_" + std::to_string(criticalPath) + "us_overlap_" +
+                                     std::to_string(overlap) + "%";
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]) - 1, 0);
+        const std::string layerType = "ParallelBranches";
+        layerType.copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]) - 1, 0);
+    }
 }
 
 void Graph::setConfig(const Config &cfg) {
@@ -1302,6 +1486,7 @@ bool Graph::InsertNode(NodePtr parent, NodePtr child, NodePtr node, int parentPo
         node->setQuantizedGraphFlag(true);
     }
     node->setRuntimeCache(rtParamsCache);
+    node->setJitCodeCache(jitCodeCache);
 
     if (initNode) {
         node->getSupportedDescriptors();
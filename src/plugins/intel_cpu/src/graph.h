@@ -11,6 +11,8 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/jit_code_cache.h"
+#include "perf_count.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -49,10 +51,15 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @param rtCache thread safe runtime parameters cache shared with other graphs,
+     * if it is not specified the graph creates its own cache
+     */
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
-                     WeightsSharing::Ptr &w_cache);
+                     WeightsSharing::Ptr &w_cache,
+                     const MultiCachePtr& rtCache = nullptr);
 
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
@@ -84,6 +91,12 @@ public:
         return graphEdges;
     }
 
+    /**
+     * @brief Returns the memory of the constant edges which are computed by the graph and stored in the weights cache
+     *        (repacked weights etc.) along with their weights cache keys, the constants of the IR are not included
+     */
+    std::vector<std::pair<std::string, MemoryPtr>> getPackedWeights() const;
+
     std::map<std::string, NodePtr>& GetInputNodesMap() {
         return inputNodesMap;
     }
@@ -116,6 +129,10 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    MultiCacheCPtr GetRuntimeCache() const {
+        return rtParamsCache;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(EdgePtr& edge);
@@ -205,6 +222,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        execLevels.clear();
+        executableGraphLevels.clear();
     }
     Status status { NotReady };
     Config config;
@@ -241,6 +260,11 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    bool CanExecuteBranchesInParallel() const;
+    void InitExecutionLevels();
+    int GetExecTimestamp(const NodePtr& node) const;
+    void InferParallelBranches(InferRequestBase* request);
+    void ExecuteBranchNode(const NodePtr& node) const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -258,7 +282,16 @@ private:
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
 
+    // Parallel branches mode: topological level of every node (indexed by execIndex) and
+    // executable nodes grouped by level. Nodes of one level have no data dependencies between each
+    // other and edge memory is solved over levels, so a whole level can be executed concurrently.
+    bool parallelBranches = false;
+    std::vector<int> execLevels;
+    std::vector<std::vector<NodePtr>> executableGraphLevels;
+    PerfCount parallelBranchesWallTime;
+
     MultiCachePtr rtParamsCache;
+    JitCodeCache::Ptr jitCodeCache;
 
     void EnforceBF16();
 };
@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -47,6 +48,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -61,7 +63,12 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations",
+                       "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -173,6 +180,129 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::FuseFullyConnectedAndWeightsDecompression(Graph &graph) {
+    if (!graph.getConfig().compressedWeights)
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstantInput = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant();
+    };
+
+    // The constant operand port of the decompression eltwise, -1 if the eltwise is not suitable
+    auto getConstantPort = [&](const NodePtr& eltwise, size_t OC) {
+        if (eltwise->getParentEdges().size() != 2)
+            return -1;
+        int constPort = isConstantInput(eltwise->getParentEdgesAtPort(1)[0]->getParent()) ? 1 : 0;
+        if (constPort == 0 && (eltwise->getAlgorithm() == Algorithm::EltwiseSubtract ||
+                               !isConstantInput(eltwise->getParentEdgesAtPort(0)[0]->getParent())))
+            return -1;
+        auto constant = eltwise->getParentEdgesAtPort(constPort)[0]->getParent();
+        if (constant->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 || !constant->getOutputShapeAtPort(0).isStatic())
+            return -1;
+        const auto& dims = constant->getOutputShapeAtPort(0).getStaticDims();
+        const auto size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        if (size != 1 && (dims.size() != 2 || dims[0] != OC || dims[1] != 1))
+            return -1;
+        return constPort;
+    };
+
+    auto getConstantData = [](const NodePtr& constant) {
+        auto input = std::dynamic_pointer_cast<node::Input>(constant);
+        if (input == nullptr)
+            IE_THROW() << "Cannot cast " << constant->getName() << " to Input node";
+        const auto& memory = input->getMemoryPtr();
+        const auto data = static_cast<const float*>(memory->GetPtr());
+        return std::vector<float>(data, data + memory->GetShape().getElementsCount());
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fc = std::dynamic_pointer_cast<node::FullyConnected>(graphNodes[i]);
+        if (!fc || fc->getInputShapeAtPort(1).getRank() != 2 || !fc->getInputShapeAtPort(1).isStatic())
+            continue;
+        const size_t OC = fc->getInputShapeAtPort(1).getStaticDims()[0];
+
+        // walk up from the weights to the Convert of the compressed Constant
+        std::vector<std::pair<NodePtr, int>> eltwises;
+        auto node = fc->getParentEdgesAtPort(1)[0]->getParent();
+        while (node->getType() == Type::Eltwise && node->getChildEdges().size() == 1 && node->getFusedWith().empty()) {
+            int constPort = -1;
+            if (node->getAlgorithm() == Algorithm::EltwisePowerStatic) {
+                auto eltwise = std::dynamic_pointer_cast<node::Eltwise>(node);
+                if (eltwise->getParentEdges().size() != 1 || eltwise->getAlpha() != 1.f)
+                    break;
+            } else if (one_of(node->getAlgorithm(), Algorithm::EltwiseAdd, Algorithm::EltwiseSubtract, Algorithm::EltwiseMultiply)) {
+                constPort = getConstantPort(node, OC);
+                if (constPort < 0)
+                    break;
+            } else {
+                break;
+            }
+            eltwises.emplace_back(node, constPort);
+            node = node->getParentEdgesAtPort(constPort == 0 ? 1 : 0)[0]->getParent();
+        }
+
+        if (node->getType() != Type::Convert || node->getChildEdges().size() != 1 || node->getParentEdges().size() != 1)
+            continue;
+        auto convert = node;
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        const auto compressedPrecision = weights->getOriginalOutputPrecisionAtPort(0);
+        if (!isConstantInput(weights) || weights->getChildEdges().size() != 1 ||
+            !one_of(compressedPrecision, Precision::FP16, Precision::U8, Precision::I8))
+            continue;
+
+        // compose the affine decompression y = scale * x + shift starting from the Convert side
+        std::vector<float> scales, shifts;
+        if (!eltwises.empty()) {
+            scales.assign(1, 1.f);
+            shifts.assign(1, 0.f);
+        }
+        auto broadcast = [&](size_t size) {
+            if (size > scales.size()) {
+                scales.resize(size, scales[0]);
+                shifts.resize(size, shifts[0]);
+            }
+        };
+        for (auto it = eltwises.rbegin(); it != eltwises.rend(); it++) {
+            const auto& eltwise = it->first;
+            if (eltwise->getAlgorithm() == Algorithm::EltwisePowerStatic) {
+                auto powerStatic = std::dynamic_pointer_cast<node::Eltwise>(eltwise);
+                for (size_t c = 0; c < scales.size(); c++) {
+                    scales[c] *= powerStatic->getBeta();
+                    shifts[c] = shifts[c] * powerStatic->getBeta() + powerStatic->getGamma();
+                }
+                continue;
+            }
+
+            const auto values = getConstantData(eltwise->getParentEdgesAtPort(it->second)[0]->getParent());
+            broadcast(values.size());
+            for (size_t c = 0; c < scales.size(); c++) {
+                const float value = values[values.size() > 1 ? c : 0];
+                switch (eltwise->getAlgorithm()) {
+                    case Algorithm::EltwiseAdd: shifts[c] += value; break;
+                    case Algorithm::EltwiseSubtract: shifts[c] -= value; break;
+                    default: scales[c] *= value; shifts[c] *= value; break;
+                }
+            }
+        }
+
+        for (const auto& eltwise : eltwises) {
+            if (eltwise.second >= 0) {
+                auto p_edge = eltwise.first->getParentEdgesAtPort(eltwise.second)[0];
+                graph.RemoveEdge(p_edge);
+            }
+            fc->addOriginalLayer(eltwise.first->getOriginalLayers());
+            graph.DropNode(eltwise.first);
+        }
+        fc->addOriginalLayer(convert->getOriginalLayers());
+        graph.DropNode(convert);
+
+        fc->setOriginalInputPrecisionAtPort(1, compressedPrecision);
+        fc->setWeightsDecompression(scales, shifts);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -20,6 +20,7 @@ public:
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
 
 private:
+    void FuseFullyConnectedAndWeightsDecompression(Graph &graph);
     void FuseConvolutionMatMulAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
@@ -102,12 +102,11 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Unexpected type of the variable state " << cur_id;
+                    }
+                    bindStateMemory(node, *cur_state);
                 }
             }
         }
@@ -121,15 +120,17 @@ void InferRequestBase::PullStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
+            // the state without Assign or updated in place keeps the current buffer
+            if (!cur_node->getOutputNode() || cur_node->isStateUpdatedInPlace())
+                continue;
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Unexpected type of the variable state " << cur_id;
+                    }
+                    cur_state->swapBuffers();
                 }
             }
         }
@@ -171,12 +172,13 @@ void InferRequestBase::InferImpl() {
 
     ThrowIfCanceled();
 
-    PushInputData();
-
+    // the states are bound before the input data is pushed, the binding may change the edges memory
     if (memoryStates.size() != 0) {
         PushStates();
     }
 
+    PushInputData();
+
     graph->Infer(this);
 
     if (memoryStates.size() != 0) {
@@ -186,6 +188,10 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+
+    if (graph->getConfig().collectPerfCounters) {
+        updateIOBinding();
+    }
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
@@ -193,13 +199,126 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestB
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
     graph->GetPerfData(perfMap);
+
+    // the records show which user blobs were used by the graph in place and which ones fell back to copies
+    for (const auto& binding : ioBinding) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[binding.first + "_io_binding"];
+        pc.execution_index = perfMap.size() - 1;
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        binding.second.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]) - 1, 0);
+        const std::string layerType = graph->GetInputNodesMap().count(binding.first) ? "InputBinding" : "OutputBinding";
+        layerType.copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]) - 1, 0);
+    }
     return perfMap;
 }
 
+void InferRequestBase::setExternalPtr(const std::string& name, const InferenceEngine::Blob::Ptr& data, bool isCompatible) {
+    // the graph nodes may access the data with the element granularity, so the pointer must be aligned at least to the element size
+    auto isAligned = [&]() {
+        const auto elemSize = data->getTensorDesc().getPrecision().size();
+        return elemSize == 0 || reinterpret_cast<uintptr_t>(data->cbuffer().as<const void*>()) % elemSize == 0;
+    };
+    if (isCompatible && isAligned()) {
+        externalPtr[name] = data->buffer();
+    } else if (externalPtr.find(name) != externalPtr.end()) {
+        externalPtr.erase(name);
+    }
+}
+
+void InferRequestBase::updateIOBinding() {
+    auto bindingType = [&](const std::string& name, const void* graphData, const InferenceEngine::Blob::Ptr& blob) -> std::string {
+        if (graphData == blob->cbuffer().as<const void*>())
+            return "zero_copy";
+        // the blob is compatible with the graph, but the edge memory is shared with in-place nodes
+        if (externalPtr.count(name))
+            return "copy_inplace_conflict";
+        return "copy_incompatible_blob";
+    };
+
+    for (const auto& input : _inputs) {
+        const auto inputNode = graph->GetInputNodesMap().find(input.first);
+        if (inputNode == graph->GetInputNodesMap().end())
+            continue;
+        ioBinding[input.first] = bindingType(input.first, inputNode->second->getChildEdgeAt(0)->getMemory().GetData(), input.second);
+    }
+    for (const auto& output : _outputs) {
+        const auto outputNode = graph->GetOutputNodesMap().find(output.first);
+        if (outputNode == graph->GetOutputNodesMap().end())
+            continue;
+        ioBinding[output.first] = bindingType(output.first, outputNode->second->getParentEdgeAt(0)->getMemory().GetData(), output.second);
+    }
+}
+
 static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
     edge->getMemoryPtr()->setDataHandle(newPtr);
 }
 
+// The child edges of the input node may refer the external memory if no consumer writes or keeps the pointer to it
+static bool canChangeInputEdgesPtr(const NodePtr &inputNodePtr) {
+    auto& childEdges = inputNodePtr->getChildEdges();
+    // Input cannot be in-place with other primitives
+    for (auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant())
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<node::Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Type::Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        auto& edges = child->getChildEdges();
+        for (auto& edge : edges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The producers of the edge may write to the external memory if the memory isn't shared with other consumers
+static bool canChangeOutputEdgePtr(const EdgePtr &parentEdge) {
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 void InferRequestBase::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         const auto& inputNodesMap = graph->GetInputNodesMap();
@@ -208,57 +327,8 @@ void InferRequestBase::changeDefaultPtr() {
             NodePtr inputNodePtr = input->second;
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
                 continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Type::Concatenation) {
-                    auto concat = dynamic_cast<node::Concat*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Type::Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
+            if (canChangeInputEdgesPtr(inputNodePtr)) {
+                for (auto& edge : inputNodePtr->getChildEdges()) {
                     auto e = edge.lock();
                     if (!e)
                         IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
@@ -277,31 +347,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            NodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (canChangeOutputEdgePtr(parentEdge))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -309,6 +355,67 @@ void InferRequestBase::changeDefaultPtr() {
     }
 }
 
+void InferRequestBase::bindStateMemory(const NodePtr &node, VariableState &state) {
+    auto memoryInput = dynamic_cast<node::MemoryInput*>(node.get());
+    if (!memoryInput)
+        IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+
+    auto current = state.getCurrentMemory();
+    auto next = state.getNextMemory();
+    memoryInput->setStateMemory(current, next);
+
+    if (node->isDynamicNode()) {
+        bindAppendedStateMemory(node, state);
+        return;
+    }
+
+    // without Assign the consumers may not refer the state, it is not swapped
+    auto memoryOutput = memoryInput->getOutputNode();
+    if (!memoryOutput)
+        return;
+
+    // ReadValue and Assign edges refer the same memory, the state is passed through
+    auto assignEdge = memoryOutput->getParentEdgeAt(0);
+    const auto assignMemoryMngr = assignEdge->getMemoryPtr()->getDnnlMemoryMngr();
+    for (auto& edge : node->getChildEdges()) {
+        auto e = edge.lock();
+        if (!e)
+            IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+        if (e->getMemoryPtr()->getDnnlMemoryMngr() == assignMemoryMngr)
+            return;
+    }
+
+    if (node->getChildEdgeAt(0)->getMemory().GetData() != current->GetData() && canChangeInputEdgesPtr(node)) {
+        for (auto& edge : node->getChildEdges())
+            changeEdgePtr(edge.lock(), current->GetData());
+    }
+
+    if (assignEdge->getMemory().GetData() != next->GetData() && canChangeOutputEdgePtr(assignEdge))
+        changeEdgePtr(assignEdge, next->GetData());
+}
+
+void InferRequestBase::bindAppendedStateMemory(const NodePtr &node, VariableState &state) {
+    if (node->getChildEdges().size() != 1)
+        return;
+    auto concat = dynamic_cast<node::Concat*>(node->getChildEdgeAt(0)->getChild().get());
+    if (!concat || !concat->isAppendToState())
+        return;
+    state.setAppendAxis(concat->getAxis());
+
+    // the edges of ReadValue and Concat share the growable state buffer, so Concat writes only the appended part
+    const auto stateMngr = state.getCurrentMemory()->getDnnlMemoryMngr();
+    const auto inputMngr = node->getChildEdgeAt(0)->getMemoryPtr()->getDnnlMemoryMngr();
+    if (inputMngr == stateMngr)
+        return;
+    const auto outputMngr = concat->getChildEdgeAt(0)->getMemoryPtr()->getDnnlMemoryMngr();
+    for (auto& edge : graph->GetEdges()) {
+        auto& memory = edge->getMemoryPtr();
+        const auto mngr = memory->getDnnlMemoryMngr();
+        if (mngr == inputMngr || mngr == outputMngr)
+            memory->Create(memory->getDescPtr(), stateMngr);
+    }
+}
+
 std::vector<InferenceEngine::IVariableStateInternal::Ptr> InferRequestBase::QueryState() {
     return memoryStates;
 }
@@ -436,12 +543,8 @@ void LegacyInferRequest::SetBlob(const std::string& name, const InferenceEngine:
                 IE_THROW() << "Blob returned after trying to interpret input node's memory is nullable. Input node name: " << name;
             }
 
-            if (data->getTensorDesc() == pBlob->getTensorDesc() &&
-                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
-                externalPtr[name] = data->buffer();
-            } else if (externalPtr.find(name) != externalPtr.end()) {
-                externalPtr.erase(name);
-            }
+            setExternalPtr(name, data, data->getTensorDesc() == pBlob->getTensorDesc() &&
+                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit);
             _inputs[name] = data;
         }
     }
@@ -473,12 +576,7 @@ void LegacyInferRequest::SetBlob(const std::string& name, const InferenceEngine:
         if (!pBlob)
             IE_THROW() << "Blob returned after trying to interpret output node's memory is nullable. Output node name: " << name;
 
-        if (data->getTensorDesc() == pBlob->getTensorDesc() &&
-                !graph->getProperty().batchLimit) {
-            externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
-            externalPtr.erase(name);
-        }
+        setExternalPtr(name, data, data->getTensorDesc() == pBlob->getTensorDesc() && !graph->getProperty().batchLimit);
         _outputs[name] = data;
     }
 }
@@ -718,12 +816,8 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
             actualDesc = actualDesc->cloneWithNewDims(blobDesc.getLayout() == InferenceEngine::Layout::SCALAR ? InferenceEngine::SizeVector{1} :
                                                                                                                 blobDesc.getDims());
         }
-        if (actualDesc->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
-                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
-            externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
-            externalPtr.erase(name);
-        }
+        setExternalPtr(name, data, actualDesc->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
+                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit);
         _inputs[name] = data;
         _batched_inputs.erase(name);
     } else {
@@ -750,12 +844,10 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
                        << " and blob size = " << data->size() << " are different.";
         }
 
+        // the blob may differ from the edge memory description in the layout name or the strides of the unit dims only
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
-            externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
-            externalPtr.erase(name);
-        }
+        setExternalPtr(name, data, !isDynamic && blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
+                desc.isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) && !graph->getProperty().batchLimit);
         _outputs[name] = data;
     }
 }
@@ -15,6 +15,7 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+class VariableState;
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -55,19 +56,39 @@ protected:
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
+    /**
+     * @brief Registers the user blob memory to be used by the graph edges directly (zero-copy)
+     * @param isCompatible whether the blob description matches the memory description of the graph port
+     * @note The blob is copied if it is not compatible or its data is not aligned to the element size
+     */
+    void setExternalPtr(const std::string& name, const InferenceEngine::Blob::Ptr& data, bool isCompatible);
+
     Graph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
 
 private:
     void PushStates();
     void PullStates();
+    /**
+     * @brief Binds the edges of ReadValue to the current state buffer and the input edge of Assign to the next one,
+     * so the state isn't copied. The nodes copy the state if the edges can't be bound.
+     */
+    void bindStateMemory(const NodePtr& node, VariableState& state);
+    /**
+     * @brief Shares the current buffer of the dynamic state with the edges of ReadValue and Concat appending to the
+     * state, so the state grows in place. The other dynamic states are copied.
+     */
+    void bindAppendedStateMemory(const NodePtr& node, VariableState& state);
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
+    void updateIOBinding();
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    // binding type of each user blob at the last inference: zero_copy or the reason of the copy
+    std::unordered_map<std::string, std::string> ioBinding;
 };
 
 class LegacyInferRequest : public InferRequestBase {
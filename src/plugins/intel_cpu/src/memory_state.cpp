@@ -5,16 +5,114 @@
 #include "memory_state.h"
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "ie_parallel.hpp"
+
+#include <numeric>
 
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name} {
+    const auto& storageDesc = storage->getDesc();
+    if (!storageDesc.isDefined()) {
+        initialDesc = storageDesc.cloneWithNewDims(storageDesc.getShape().getMinDims());
+        const auto& eng = storage->getEngine();
+        current = std::make_shared<Memory>(eng, std::unique_ptr<IMemoryMngr>(new MemoryMngrWithGrowth()));
+        current->Create(initialDesc);
+        current->FillZero();
+        next = std::make_shared<Memory>(eng, std::unique_ptr<IMemoryMngr>(new MemoryMngrWithGrowth()));
+        next->Create(initialDesc);
+        return;
+    }
+
+    const auto tensorDesc = MemoryDescUtils::convertToTensorDesc(storage->getDesc());
+
+    current = std::make_shared<Memory>(storage->getEngine());
+    current->Create(storage->getDesc());
+    cpu_memcpy(current->GetData(), storage->GetData(), storage->GetSize());
+    state = make_blob_with_precision(tensorDesc, current->GetData());
+
+    next = std::make_shared<Memory>(storage->getEngine());
+    next->Create(storage->getDesc());
+    nextState = make_blob_with_precision(tensorDesc, next->GetData());
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    if (isDynamic()) {
+        // the state appended along the axis keeps the other dims (e.g. the batch of the key-value cache)
+        auto dims = initialDesc->getShape().getStaticDims();
+        if (appendAxis < dims.size() && current->getDesc().isDefined()) {
+            const auto axisDim = dims[appendAxis];
+            dims = current->getStaticDims();
+            dims[appendAxis] = axisDim;
+        }
+        current->redefineDesc(initialDesc->cloneWithNewDims(dims));
+    }
+    current->FillZero();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (isDynamic()) {
+        const auto& newDesc = newState->getTensorDesc();
+        if (newDesc.getPrecision() != initialDesc->getPrecision())
+            IE_THROW() << "The state " << name << " has " << initialDesc->getPrecision()
+                       << " precision, but the new state has " << newDesc.getPrecision() << " precision";
+        current->redefineDesc(initialDesc->cloneWithNewDims(newDesc.getDims()));
+        cpu_memcpy(current->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
+        return;
+    }
+
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "The state " << name << " has " << state->byteSize() << " bytes, but the new state has "
+                   << newState->byteSize() << " bytes";
+
+    cpu_memcpy(current->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    if (!isDynamic())
+        return state;
+
+    // the buffer may be reallocated by the following inferences, so the state is copied
+    const auto& dims = current->getStaticDims();
+    const TensorDesc tensorDesc(initialDesc->getPrecision(), dims, TensorDesc::getLayoutByDims(dims));
+    auto blob = make_blob_with_precision(tensorDesc);
+    blob->allocate();
+    if (current->GetShape().hasZeroDims())
+        return blob;
+
+    // the state appended in place is strided along the axis (see node::Concat), the dense suffix of the dims is
+    // copied at once
+    const auto blockedDesc = current->GetDescWithType<BlockedMemoryDesc>();
+    const auto& strides = blockedDesc->getStrides();
+    size_t denseDims = dims.size();
+    size_t chunk = 1;
+    while (denseDims > 0 && strides[denseDims - 1] == chunk) {
+        chunk *= dims[denseDims - 1];
+        denseDims--;
+    }
+    const size_t dataSize = initialDesc->getPrecision().size();
+    const size_t chunks = std::accumulate(dims.begin(), dims.begin() + denseDims, size_t(1), std::multiplies<size_t>());
+    auto dst = blob->buffer().as<uint8_t*>();
+    auto src = reinterpret_cast<const uint8_t*>(current->GetData());
+    parallel_for(chunks, [&](size_t i) {
+        size_t offset = 0;
+        for (size_t j = denseDims, index = i; j > 0; j--) {
+            offset += (index % dims[j - 1]) * strides[j - 1];
+            index /= dims[j - 1];
+        }
+        cpu_memcpy(dst + i * chunk * dataSize, src + offset * dataSize, chunk * dataSize);
+    });
+    return blob;
+}
+
+void VariableState::swapBuffers() {
+    std::swap(current, next);
+    std::swap(state, nextState);
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
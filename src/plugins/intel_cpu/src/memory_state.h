@@ -10,21 +10,69 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <limits>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The state is kept in two buffers: ReadValue reads the current one, Assign writes the next one and the buffers
+ * are swapped after the inference, so the state isn't copied between the inferences.
+ * GetState returns the view of the current buffer (the copy for the dynamic variable).
+ * The shape of the dynamic variable may change between the inferences, it is empty until it is set or written. Its
+ * buffers keep the data on growth and double the capacity, so the state appended in place (see node::Concat) takes
+ * the amortized constant time per appended element. Such a state is empty along the axis after the reset, the other
+ * dims are kept.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    VariableState(std::string name, MemoryPtr storage);
 
     void Reset() override;
+
+    /**
+     * @brief The data of the blob is copied into the current buffer, so the blob may be changed or released by the
+     * caller afterwards. The blob is not adopted: the buffers are swapped with the memory of the graph, which must
+     * outlive the caller's blob and keep the graph layout. The copy is done once per call, not per inference.
+     */
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    MemoryPtr getCurrentMemory() const {
+        return current;
+    }
+
+    MemoryPtr getNextMemory() const {
+        return next;
+    }
+
+    /**
+     * @brief Makes the next buffer written by the inference the current one
+     */
+    void swapBuffers();
+
+    /**
+     * @brief Sets the axis along which the dynamic state is appended in place, the reset keeps the other dims
+     */
+    void setAppendAxis(size_t axis) {
+        appendAxis = axis;
+    }
+
+private:
+    bool isDynamic() const {
+        return initialDesc != nullptr;
+    }
+
+    /**
+     * @brief The descriptor of the reset state of the dynamic variable, nullptr for the static one
+     */
+    MemoryDescPtr initialDesc;
+    size_t appendAxis = std::numeric_limits<size_t>::max();
+    MemoryPtr current;
+    MemoryPtr next;
+    InferenceEngine::Blob::Ptr nextState;
 };
 
 }   // namespace intel_cpu
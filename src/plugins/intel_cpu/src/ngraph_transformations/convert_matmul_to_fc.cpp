@@ -8,13 +8,51 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
 
 #include "itt.hpp"
 
-ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
+namespace {
+
+/*
+ * Collects the weights decompression subgraph kept by KeepCompressedMatMulWeights starting from the MatMul weights:
+ * the eltwise operations with the Constant second input and the Convert of the compressed Constant.
+ * The nodes are stored from the MatMul side, the Convert is the last one.
+ */
+bool getDecompressionSubgraph(const ngraph::Output<ngraph::Node>& weights, ngraph::NodeVector& subgraph) {
+    auto node = weights.get_node_shared_ptr();
+    while (ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Add>(node) ||
+           ngraph::is_type<ngraph::opset1::Subtract>(node)) {
+        const bool constOnSecondPort = ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1));
+        const size_t dataPort = constOnSecondPort ? 0 : 1;
+        if (!ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1 - dataPort)) ||
+            (ngraph::is_type<ngraph::opset1::Subtract>(node) && dataPort != 0) ||
+            node->get_output_target_inputs(0).size() != 1) {
+            return false;
+        }
+        subgraph.push_back(node);
+        node = node->get_input_node_shared_ptr(dataPort);
+    }
+
+    // the Converts excluded from ConstantFolding by LPT don't keep the precision of the Constant
+    const auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(node);
+    if (!convert || !ov::pass::constant_folding_is_disabled(convert) ||
+        !ngraph::is_type<ngraph::opset1::Constant>(convert->get_input_node_ptr(0)) ||
+        !ov::is_keep_const_precision(convert->get_input_node_shared_ptr(0)) ||
+        convert->get_output_target_inputs(0).size() != 1) {
+        return false;
+    }
+    subgraph.push_back(convert);
+    return true;
+}
+
+}   // namespace
+
+ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC(bool enableCompressedWeights) {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -43,10 +81,16 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
             return false;
         }
 
+        // The compressed 2D weights are passed to FullyConnected with the decompression subgraph
+        ngraph::NodeVector decompression;
+        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) &&
+            (!enableCompressedWeights || rank_b != 2 || !getDecompressionSubgraph(fc_input_b, decompression))) {
+            return false;
+        }
+
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-            std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
+        if (std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
         /*
@@ -135,7 +179,42 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
         // Weights normalization
-        if (!matmul->get_transpose_b()) {
+        if (!decompression.empty()) {
+            // The compressed Constant and the decompression constants are transposed, the decompression is kept
+            // on the transposed weights. Non-scalar decompression constants are aligned to the 2D weights first.
+            auto normalizeDecompressionInput = [&](const ngraph::Output<ngraph::Node>& input, const std::string& name) {
+                if (matmul->get_transpose_b() || ngraph::shape_size(input.get_shape()) == 1)
+                    return input;
+                ngraph::Output<ngraph::Node> aligned = input;
+                if (input.get_shape().size() < 2) {
+                    std::vector<int64_t> alignedShapeValues = { 1ll, static_cast<int64_t>(ngraph::shape_size(input.get_shape())) };
+                    auto alignedShape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, alignedShapeValues);
+                    aligned = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(input, alignedShape, false);
+                }
+                auto transposed = create_transpose(aligned, name);
+                new_ops.push_back(transposed);
+                return ngraph::Output<ngraph::Node>(transposed);
+            };
+
+            const auto& convert = decompression.back();
+            ngraph::Output<ngraph::Node> decompressed = normalizeDecompressionInput(convert->input_value(0),
+                                                                                    matmul->get_friendly_name() + "/transpose_b");
+            decompressed = convert->clone_with_new_inputs({ decompressed });
+            ngraph::copy_runtime_info(convert, decompressed.get_node_shared_ptr());
+            ov::pass::disable_constant_folding(decompressed.get_node_shared_ptr());
+            for (auto it = decompression.rbegin() + 1; it != decompression.rend(); ++it) {
+                const auto& eltwise = *it;
+                const size_t constPort = ngraph::is_type<ngraph::opset1::Constant>(eltwise->get_input_node_ptr(1)) ? 1 : 0;
+                ngraph::OutputVector inputs(2);
+                inputs[constPort] = normalizeDecompressionInput(eltwise->input_value(constPort),
+                                                                eltwise->get_friendly_name() + "/transpose_b");
+                inputs[1 - constPort] = decompressed;
+                decompressed = eltwise->clone_with_new_inputs(inputs);
+                ngraph::copy_runtime_info(eltwise, decompressed.get_node_shared_ptr());
+                decompressed.get_node_shared_ptr()->set_friendly_name(eltwise->get_friendly_name());
+            }
+            fc_input_b = decompressed;
+        } else if (!matmul->get_transpose_b()) {
             fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
             new_ops.push_back(fc_input_b.get_node_shared_ptr());
         }
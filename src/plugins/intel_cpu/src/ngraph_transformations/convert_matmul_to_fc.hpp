@@ -12,7 +12,11 @@ namespace intel_cpu {
 class ConvertMatMulToFC: public ngraph::pass::MatcherPass {
 public:
     OPENVINO_RTTI("ConvertMatMulToFC", "0");
-    ConvertMatMulToFC();
+    /**
+     * @param enableCompressedWeights the compressed weights kept by KeepCompressedMatMulWeights are passed to
+     * FullyConnected with their decompression subgraph, otherwise only the constant weights are supported
+     */
+    explicit ConvertMatMulToFC(bool enableCompressedWeights = false);
 };
 
 }   // namespace intel_cpu
@@ -144,7 +144,9 @@ bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
                                   ov::is_type<ngraph::op::v0::LSTMCell>(node) ||
                                   ov::is_type<ngraph::op::v4::LSTMCell>(node) ||
                                   ov::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
-                                  ov::is_type<ngraph::op::util::ArithmeticReductionKeepDims>(node) ||
+                                  (ov::is_type<ngraph::op::util::ArithmeticReductionKeepDims>(node) &&
+                                   // reductions over the innermost dimension are fused into snippets with both producers and consumers
+                                   !ngraph::snippets::pass::AppropriateForSubgraph(node)) ||
                                   ov::is_type<ngraph::op::util::LogicalReductionKeepDims>(node) ||
                                   ov::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node);
     // has a single output, connected to a single child
@@ -30,6 +30,7 @@
 #include "cpu_shape.h"
 #include "nodes/node_config.h"
 #include "cache/multi_cache.h"
+#include "cache/jit_code_cache.h"
 
 #include <utils/shape_inference/static_shape.hpp>
 #include <utils/shape_inference/shape_inference.hpp>
@@ -571,6 +572,17 @@ public:
         rtParamsCache = cache;
     }
 
+    void setJitCodeCache(JitCodeCache::Ptr cache) {
+        jitCodeCache = cache;
+    }
+
+    /**
+     * @brief Sets the scratch memory shared with the nodes of the graph which are never executed at the same time
+     */
+    void setScratchPad(std::shared_ptr<IMemoryMngr> pad) {
+        scratchPad = pad;
+    }
+
 protected:
     bool canFuseSimpleOperation(const NodePtr& node) const;
 
@@ -740,6 +752,23 @@ protected:
         return rtParamsCache;
     }
 
+    /**
+     * @brief Persistent cache of the JIT kernels code, nullptr if CACHE_DIR is not set or the cache is disabled
+     */
+    JitCodeCache::Ptr getJitCodeCache() const {
+        return jitCodeCache;
+    }
+
+    /**
+     * @brief Scratch memory of at least the given size in bytes, its content is not kept between the executions
+     */
+    void* getScratchPad(size_t size) {
+        if (!scratchPad)
+            scratchPad = std::make_shared<MemoryMngrWithReuse>();
+        scratchPad->resize(size);
+        return scratchPad->getRawPtr();
+    }
+
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
@@ -766,6 +795,8 @@ private:
     PerfCounters profiling;
 
     MultiCachePtr rtParamsCache;
+    JitCodeCache::Ptr jitCodeCache;
+    std::shared_ptr<IMemoryMngr> scratchPad;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
@@ -4,7 +4,10 @@
 
 #include "concat.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
+#include <numeric>
 #include <utility>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -18,6 +21,7 @@
 #include "fake_quantize.h"
 #include "pooling.h"
 #include "eltwise.h"
+#include "memory.hpp"
 #include <limits>
 #include "common/cpu_memcpy.h"
 #include "common/blocked_desc_creator.h"
@@ -351,9 +355,65 @@ bool Concat::needPrepareParams() const {
     if (canOptimizeNspc) {
         return false;
     }
+    // the primitive is used only if the state isn't appended in place on this inference
+    if (appendToState) {
+        return !isAppendedInPlace();
+    }
     return inputShapesModified();
 }
 
+void Concat::createPrimitive() {
+    appendToState = canAppendToState();
+    Node::createPrimitive();
+}
+
+bool Concat::canAppendToState() const {
+    if (!isDynamicNode() || isOptimized() || getParentEdges().size() != 2 || inputPrecision != outputPrecision)
+        return false;
+
+    auto parent = getParentEdgesAtPort(0)[0]->getParent();
+    auto memoryInput = dynamic_cast<MemoryInput*>(parent.get());
+    if (!memoryInput || parent->getChildEdges().size() != 1 || !memoryInput->getOutputNode())
+        return false;
+
+    const auto& childEdges = getChildEdgesAtPort(0);
+    if (std::none_of(childEdges.begin(), childEdges.end(), [&](const EdgePtr& edge) {
+            return edge->getChild().get() == memoryInput->getOutputNode();
+        }))
+        return false;
+
+    // the state is strided along the axis unless the dims before the axis are 1, the consumers must read the strides
+    const auto& dims = getOutputShapeAtPort(0).getDims();
+    if (!std::all_of(dims.begin(), dims.begin() + axis, [](size_t dim) { return dim == 1; }) &&
+        std::any_of(childEdges.begin(), childEdges.end(), [](const EdgePtr& edge) {
+            return !one_of(edge->getChild()->getType(), Type::MemoryOutput, Type::MatMul);
+        }))
+        return false;
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    for (const auto& portConfig : config.inConfs) {
+        if (!portConfig.getMemDesc()->hasLayoutType(LayoutType::ncsp))
+            return false;
+    }
+    return config.outConfs[0].getMemDesc()->hasLayoutType(LayoutType::ncsp);
+}
+
+std::vector<VectorDims> Concat::shapeInfer() const {
+    // the empty state takes the dims of the appended part, the dims before the axis (e.g. the batch of the key-value
+    // cache) are unknown until the first append
+    if (appendToState) {
+        const auto& stateDims = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+        if (stateDims[axis] == 0)
+            return {getParentEdgesAtPort(1)[0]->getMemory().getStaticDims()};
+    }
+    return Node::shapeInfer();
+}
+
+bool Concat::isAppendedInPlace() const {
+    return appendToState &&
+           getParentEdgesAtPort(0)[0]->getMemory().GetData() == getChildEdgesAtPort(0)[0]->getMemory().GetData();
+}
+
 void Concat::prepareParams() {
     if (canOptimizeNspc || isOptimized())
         return;
@@ -493,6 +553,11 @@ void Concat::execute(dnnl::stream strm) {
         return;
     }
 
+    if (isAppendedInPlace()) {
+        execAppend();
+        return;
+    }
+
     const Memory& dst_memory = getChildEdgeAt(0)->getMemory();
     if (canOptimizeNspc) {
         execNspcSpecCase();
@@ -518,6 +583,64 @@ InferenceEngine::Precision Concat::getRuntimePrecision() const {
     return getMaxPrecision(getInputPrecisions());
 }
 
+void Concat::execAppend() {
+    // the first input is the state in the output buffer already, the rows of the state are capacity apart along the
+    // axis, so the second input is appended to each row in place
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const Memory& state_memory = getParentEdgesAtPort(0)[0]->getMemory();
+    const Memory& new_memory = getParentEdgesAtPort(1)[0]->getMemory();
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    if (dstMemPtr->GetShape().hasZeroDims())
+        return;
+
+    const size_t outer = std::accumulate(dstDims.begin(), dstDims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t inner = std::accumulate(dstDims.begin() + axis + 1, dstDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t stateLength = state_memory.getStaticDims()[axis];
+    const size_t newLength = new_memory.getStaticDims()[axis];
+    const size_t length = stateLength + newLength;
+    size_t stateCapacity = stateLength;
+    if (axis > 0 && stateLength != 0)
+        stateCapacity = state_memory.GetDescWithType<BlockedMemoryDesc>()->getStrides()[axis - 1] / inner;
+
+    // the capacity depends only on the length, so the consumers get the same strides for the same dims, it is at
+    // least doubled on each growth, so the rows are moved O(log n) times
+    size_t capacity = length;
+    if (axis > 0) {
+        capacity = 1;
+        while (capacity < length)
+            capacity *= 2;
+    }
+
+    VectorDims strides(dstDims.size(), 1);
+    for (size_t i = dstDims.size() - 1; i > 0; i--)
+        strides[i - 1] = strides[i] * (i == axis ? capacity : dstDims[i]);
+    VectorDims order(dstDims.size());
+    std::iota(order.begin(), order.end(), 0);
+    const auto dstDesc = std::make_shared<CpuBlockedMemoryDesc>(outputPrecision, Shape(dstDims), dstDims, order, 0,
+                                                                VectorDims{}, strides);
+    // the buffer grows keeping the data at the same offsets
+    for (auto& edge : getChildEdgesAtPort(0))
+        edge->getMemoryPtr()->redefineDesc(dstDesc);
+
+    const size_t dataSize = outputPrecision.size();
+    uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dstMemPtr->GetData());
+    const size_t stateRowSize = stateLength * inner * dataSize;
+    if (capacity != stateCapacity && stateRowSize != 0) {
+        // the capacity only grows, so the rows are moved from the last one
+        for (size_t i = outer - 1; i > 0; i--)
+            std::memmove(dst_ptr + i * capacity * inner * dataSize, dst_ptr + i * stateCapacity * inner * dataSize,
+                         stateRowSize);
+    }
+
+    if (newLength == 0)
+        return;
+    const uint8_t* new_ptr = reinterpret_cast<const uint8_t*>(new_memory.GetData());
+    const size_t newRowSize = newLength * inner * dataSize;
+    parallel_for(outer, [&](size_t i) {
+        cpu_memcpy(dst_ptr + (i * capacity + stateLength) * inner * dataSize, new_ptr + i * newRowSize, newRowSize);
+    });
+}
+
 void Concat::execNspcSpecCase() {
     const Memory& dst_memory = getChildEdgeAt(0)->getMemory();
     const size_t num_src = getParentEdges().size();
@@ -28,19 +28,39 @@ public:
 
     bool isOptimized() const;
 
+    /**
+     * @brief Checks whether the node appends the second input to the variable state read by the first input and
+     * written back by the output. The state edges may share the state buffer, then only the second input is copied.
+     * The shared buffer keeps the power of two capacity along the axis for each index of the dims before the axis,
+     * so the output is strided along the axis (e.g. the [batch, heads, length, size] key-value cache).
+     */
+    bool isAppendToState() const {
+        return appendToState;
+    }
+
+    size_t getAxis() const {
+        return axis;
+    }
+
     InferenceEngine::Precision getRuntimePrecision() const override;
 
     bool isExecutable() const override;
     bool needPrepareParams() const override;
     void prepareParams() override;
+    void createPrimitive() override;
+    std::vector<VectorDims> shapeInfer() const override;
 
 private:
     size_t axis = 0;
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
+    bool appendToState = false;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
     void execNspcSpecCase();
+    bool canAppendToState() const;
+    bool isAppendedInPlace() const;
+    void execAppend();
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
@@ -50,10 +50,10 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    if (inDataPrecision == Precision::BF16 && !isJitSupportedPrecision(inDataPrecision))
         inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
-        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
+        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end() && !isJitSupportedPrecision(inDataPrecision))
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     } else {
         static const std::set<Precision> defaultSupportedPrecisions =
@@ -70,13 +70,14 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingBagOffsetSum::prepareParams() {
     _indicesLen = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _offsetsLen = getParentEdgesAtPort(OFFSETS_IDX)[0]->getMemory().getStaticDims()[0];
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMem = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    EmbeddingBagSum::prepareParams(tableMem.getStaticDims(), tableMem.getDesc().getPrecision());
 }
 
 void EmbeddingBagOffsetSum::initFromInputs() {
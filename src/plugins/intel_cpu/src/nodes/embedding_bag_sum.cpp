@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,13 +11,241 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "emitters/jit_bf16_emitters.hpp"
+#include "utils/bfloat16.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_sum_kernel_f32 : public jit_uni_emb_bag_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_sum_kernel_f32)
+
+    explicit jit_uni_emb_bag_sum_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_sum_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        data_size = jcp_.src_prc.size();
+        if (jcp_.src_prc == Precision::BF16 && !mayiuse(avx512_core_bf16))
+            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        if (jcp_.with_weights)
+            mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+        mov(reg_row_size, jcp_.emb_depth * data_size);
+
+        // the depth is split into blocks of unroll vectors, the accumulators of a block stay in registers
+        // while the rows of all the bag indices are gathered
+        const size_t blockSize = unroll * vlen;
+        const size_t blocksNum = jcp_.emb_depth / blockSize;
+        const size_t tail = jcp_.emb_depth % blockSize;
+
+        if (tail % vlen)
+            prepare_tail_mask(tail % vlen);
+
+        if (blocksNum) {
+            Label block_loop;
+            mov(reg_blocks, blocksNum);
+            L(block_loop);
+            {
+                accumulate_block(unroll, 0);
+                add(reg_src, blockSize * data_size);
+                add(reg_dst, blockSize * data_size);
+                dec(reg_blocks);
+                jnz(block_loop, T_NEAR);
+            }
+        }
+        if (tail)
+            accumulate_block(tail / vlen, tail % vlen);
+
+        this->postamble();
+
+        if (emu_vcvtneps2bf16)
+            emu_vcvtneps2bf16->emit_data();
+        if (isa != avx512_common && tail % vlen) {
+            align(64);
+            L(l_tail_mask);
+            for (size_t i = 0; i < vlen; i++)
+                dd(i < tail % vlen ? 0xffffffff : 0);
+        }
+    }
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const size_t unroll = isa == avx512_common ? 8 : 4;
+    // distance in indices between the row being accumulated and the prefetched one
+    const size_t prefetchDistance = 8;
+    size_t data_size = sizeof(float);
+
+    Xbyak::Reg64 reg_params = abi_param1;
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_row_size = r13;
+    Xbyak::Reg64 reg_blocks = r14;
+    Xbyak::Reg64 reg_idx_ptr = r15;
+    Xbyak::Reg64 reg_w_ptr = rax;
+    Xbyak::Reg64 reg_cnt = rbx;
+    Xbyak::Reg64 reg_row = rdx;
+    Xbyak::Reg64 reg_prefetch = rsi;
+    Xbyak::Reg64 reg_tmp = rbp;
+
+    // accumulators take Vmm(0) ... Vmm(unroll)
+    Vmm vmm_val = Vmm(unroll + 1);
+    Vmm vmm_weight = Vmm(unroll + 2);
+    Vmm vmm_tail_mask = Vmm(unroll + 3);
+    Xbyak::Opmask k_tail_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_tail_mask;
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16 = nullptr;
+
+    void prepare_tail_mask(size_t tailSize) {
+        if (isa == avx512_common) {
+            mov(reg_tmp.cvt32(), (1 << tailSize) - 1);
+            kmovw(k_tail_mask, reg_tmp.cvt32());
+        } else {
+            mov(reg_tmp, l_tail_mask);
+            uni_vmovups(vmm_tail_mask, ptr[reg_tmp]);
+        }
+    }
+
+    void accumulate_block(size_t vecsNum, size_t tailSize) {
+        const size_t accNum = vecsNum + (tailSize ? 1 : 0);
+        for (size_t i = 0; i < accNum; i++)
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+
+        mov(reg_idx_ptr, reg_indices);
+        if (jcp_.with_weights)
+            mov(reg_w_ptr, reg_weights);
+        mov(reg_cnt, reg_indices_num);
+
+        Label index_loop, index_loop_end, skip_prefetch;
+        L(index_loop);
+        {
+            cmp(reg_cnt, 0);
+            je(index_loop_end, T_NEAR);
+
+            movsxd(reg_row, dword[reg_idx_ptr]);
+            imul(reg_row, reg_row_size);
+            add(reg_row, reg_src);
+
+            // the rows are gathered from a huge table in random order, so hardware prefetcher doesn't help
+            Label no_prefetch;
+            cmp(reg_cnt, prefetchDistance);
+            jbe(no_prefetch, T_NEAR);
+            movsxd(reg_prefetch, dword[reg_idx_ptr + prefetchDistance * sizeof(int)]);
+            imul(reg_prefetch, reg_row_size);
+            add(reg_prefetch, reg_src);
+            for (size_t offset = 0; offset < accNum * vlen * data_size; offset += 64)
+                prefetcht0(ptr[reg_prefetch + offset]);
+            L(no_prefetch);
+
+            if (jcp_.with_weights)
+                load_weight();
+            for (size_t i = 0; i < accNum; i++) {
+                load_vector(vmm_val, ptr[reg_row + i * vlen * data_size], i == vecsNum);
+                if (jcp_.with_weights)
+                    uni_vfmadd231ps(Vmm(i), vmm_val, vmm_weight);
+                else
+                    uni_vaddps(Vmm(i), Vmm(i), vmm_val);
+            }
+
+            add(reg_idx_ptr, sizeof(int));
+            if (jcp_.with_weights)
+                add(reg_w_ptr, data_size);
+            dec(reg_cnt);
+            jmp(index_loop, T_NEAR);
+        }
+        L(index_loop_end);
+
+        for (size_t i = 0; i < accNum; i++)
+            store_vector(ptr[reg_dst + i * vlen * data_size], Vmm(i), i == vecsNum);
+    }
+
+    void load_weight() {
+        if (jcp_.src_prc == Precision::BF16) {
+            vpbroadcastw(vmm_weight, ptr[reg_w_ptr]);
+            uni_vpslld(vmm_weight, vmm_weight, 16);
+        } else {
+            uni_vbroadcastss(vmm_weight, ptr[reg_w_ptr]);
+        }
+    }
+
+    void load_vector(const Vmm& vmm, const Xbyak::Address& addr, bool isTail) {
+        if (jcp_.src_prc == Precision::BF16) {
+            if (isTail)
+                vpmovzxwd(vmm | k_tail_mask | T_z, addr);
+            else
+                vpmovzxwd(vmm, addr);
+            uni_vpslld(vmm, vmm, 16);
+        } else if (!isTail) {
+            uni_vmovups(vmm, addr);
+        } else if (isa == avx512_common) {
+            vmovups(vmm | k_tail_mask | T_z, addr);
+        } else {
+            vmaskmovps(vmm, vmm_tail_mask, addr);
+        }
+    }
+
+    void store_vector(const Xbyak::Address& addr, const Vmm& vmm, bool isTail) {
+        if (jcp_.src_prc == Precision::BF16) {
+            Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_val.getIdx());
+            if (mayiuse(avx512_core_bf16))
+                vcvtneps2bf16(ymm_dst, vmm);
+            else
+                emu_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
+            if (isTail)
+                vmovdqu16(addr | k_tail_mask, ymm_dst);
+            else
+                vmovdqu16(addr, ymm_dst);
+        } else if (!isTail) {
+            uni_vmovups(addr, vmm);
+        } else if (isa == avx512_common) {
+            vmovups(addr | k_tail_mask, vmm);
+        } else {
+            vmaskmovps(addr, vmm_tail_mask, vmm);
+        }
+    }
+};
+
+std::shared_ptr<jit_uni_emb_bag_sum_kernel> jit_uni_emb_bag_sum_kernel::create(const jit_emb_bag_config_params& jcp) {
+    std::shared_ptr<jit_uni_emb_bag_sum_kernel> kernel;
+    if (jcp.src_prc == Precision::BF16) {
+        if (mayiuse(avx512_core))
+            kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx512_common>(jcp));
+    } else if (jcp.src_prc == Precision::FP32) {
+        if (mayiuse(avx512_common))
+            kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx512_common>(jcp));
+        else if (mayiuse(avx2))
+            kernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx2>(jcp));
+    }
+    if (kernel)
+        kernel->create_ker();
+    return kernel;
+}
+
 EmbeddingBagSum::EmbeddingBagSum(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -39,11 +268,39 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& srcPrc) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (_kernel && _kernel->jcp_.src_prc == srcPrc && _kernel->jcp_.emb_depth == _embDepth)
+        return;
+    _kernel.reset();
+    if (_embDepth == 0 || !one_of(srcPrc, Precision::FP32, Precision::BF16))
+        return;
+
+    jit_emb_bag_config_params jcp;
+    jcp.src_prc = srcPrc;
+    jcp.emb_depth = _embDepth;
+    jcp.with_weights = _withWeights;
+    _kernel = jit_uni_emb_bag_sum_kernel::create(jcp);
+}
+
+bool EmbeddingBagSum::isJitSupportedPrecision(const InferenceEngine::Precision& prc) {
+    return prc == Precision::BF16 && mayiuse(avx512_core);
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const InferenceEngine::Precision& prc) {
+    if (prc == Precision::BF16)
+        return mayiuse(avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::ref_any;
+    if (prc == Precision::FP32) {
+        if (mayiuse(avx512_common))
+            return impl_desc_type::jit_avx512;
+        if (mayiuse(avx2))
+            return impl_desc_type::jit_avx2;
+    }
+    return impl_desc_type::ref_any;
 }
 
 template<typename T>
@@ -118,8 +375,64 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dst
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                     const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const size_t dataSize = _kernel->jcp_.src_prc.size();
+    const size_t rowSize = _embDepth * dataSize;
+    // the kernel is compiled with weights if the node has them, the bags without weights (default index) are multiplied by one
+    static const float oneF32 = 1.f;
+    static const bfloat16_t oneBF16 = bfloat16_t(1.f);
+    const void* one = _kernel->jcp_.src_prc == Precision::BF16 ? static_cast<const void*>(&oneBF16) : static_cast<const void*>(&oneF32);
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            uint8_t* dst = dstData + obi * rowSize;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                std::memset(dst, 0, rowSize);
+                continue;
+            }
+
+            for (size_t i = 0lu; i < indicesSize; i++) {
+                if (static_cast<size_t>(indices[i]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[i]);
+                }
+            }
+
+            jit_emb_bag_call_args args;
+            args.src = srcData;
+            args.indices = indices;
+            args.weights = withWeights && _withWeights ? weightsData + weightsIdx * dataSize : one;
+            args.dst = dst;
+            args.indices_num = indicesSize;
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    if (_kernel && _kernel->jcp_.src_prc == srcPrc)
+        return processDataJit(srcData, weightsData, dstData, inDims, outDims);
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
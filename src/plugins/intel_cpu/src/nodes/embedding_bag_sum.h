@@ -14,6 +14,43 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_emb_bag_config_params {
+    // precision of the embedding table, per sample weights and output: FP32 or BF16
+    InferenceEngine::Precision src_prc;
+    size_t emb_depth;
+    bool with_weights;
+};
+
+struct jit_emb_bag_call_args {
+    const void* src;
+    const int* indices;
+    const void* weights;
+    void* dst;
+    size_t indices_num;
+};
+
+/**
+ * Computes one bag: dst = sum(src[indices[i]] * weights[i]), the accumulation is performed in FP32.
+ * Indices must be validated by the caller.
+ */
+struct jit_uni_emb_bag_sum_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_sum_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    static std::shared_ptr<jit_uni_emb_bag_sum_kernel> create(const jit_emb_bag_config_params& jcp);
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class EmbeddingBagSum {
 public:
     EmbeddingBagSum(
@@ -37,11 +74,17 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& srcPrc);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+
+    // the precisions which can be handled by the jit kernel in addition to the reference ones
+    static bool isJitSupportedPrecision(const InferenceEngine::Precision& prc);
+    static impl_desc_type getImplType(const InferenceEngine::Precision& prc);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -50,6 +93,7 @@ protected:
 
     bool _withWeights = false;
     size_t _embDepth = 0;
+    std::shared_ptr<jit_uni_emb_bag_sum_kernel> _kernel;
     std::string _layerName;
 };
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -53,10 +54,10 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    if (inDataPrecision == Precision::BF16 && !isJitSupportedPrecision(inDataPrecision))
         inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
-        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
+        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end() && !isJitSupportedPrecision(inDataPrecision))
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     } else {
         static const std::set<Precision> defaultSupportedPrecisions =
@@ -74,11 +75,12 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMem = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    EmbeddingBagSum::prepareParams(tableMem.getStaticDims(), tableMem.getDesc().getPrecision());
 }
 
 void EmbeddingSegmentsSum::initFromInputs() {
@@ -94,6 +96,18 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // segment ids are sorted, so every segment is a contiguous range of indices which is found in a single pass
+    // instead of scanning all the segment ids for every output bag
+    segmentStarts_.assign(std::max(numSegments_, 0), 0);
+    segmentSizes_.assign(std::max(numSegments_, 0), 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= numSegments_)
+            continue;
+        if (segmentSizes_[segmentId]++ == 0)
+            segmentStarts_[segmentId] = si;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -101,17 +115,12 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentSizes_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentStarts_[embIndex];
+        weightsIdx = segmentStarts_[embIndex];
     }
 
     // Empty bag
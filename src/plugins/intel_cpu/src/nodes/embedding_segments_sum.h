@@ -46,6 +46,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    std::vector<size_t> segmentStarts_;
+    std::vector<size_t> segmentSizes_;
 };
 
 }   // namespace node
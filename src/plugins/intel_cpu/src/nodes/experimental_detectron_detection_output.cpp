@@ -7,6 +7,7 @@
 
 #include <ngraph/op/experimental_detectron_detection_output.hpp>
 #include "ie_parallel.hpp"
+#include "common/cpu_memcpy.h"
 #include "experimental_detectron_detection_output.h"
 
 using namespace InferenceEngine;
@@ -15,29 +16,6 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
-struct Indexer {
-    const std::vector<int> dims_;
-    int total_{1};
-
-    explicit Indexer(const std::vector<int>& dims) : dims_(dims) {
-        total_ = 1;
-        for (size_t i = 0; i < dims_.size(); ++i) {
-            total_ *= dims_[i];
-        }
-    }
-
-    int operator()(const std::vector<int>& idx) const {
-        int flat_idx = 0;
-        assert(idx.size() == dims_.size());
-        for (size_t i = 0; i < dims_.size(); ++i) {
-            assert(0 <= idx[i] && idx[i] < dims_[i]);
-            flat_idx = flat_idx * dims_[i] + idx[i];
-        }
-        assert(flat_idx < total_);
-        return flat_idx;
-    }
-};
-
 static
 void refine_boxes(const float* boxes, const float* deltas, const float* weights, const float* scores,
                   float* refined_boxes, float* refined_boxes_areas, float* refined_scores,
@@ -45,21 +23,17 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
                   const float img_H, const float img_W,
                   const float max_delta_log_wh,
                   float coordinates_offset) {
-    Indexer box_idx({rois_num, 4});
-    Indexer delta_idx({rois_num, classes_num, 4});
-    Indexer score_idx({rois_num, classes_num});
-
-    Indexer refined_box_idx({classes_num, rois_num, 4});
-    Indexer refined_score_idx({classes_num, rois_num});
-
-    for (int roi_idx = 0; roi_idx < rois_num; ++roi_idx) {
-        float x0 = boxes[box_idx({roi_idx, 0})];
-        float y0 = boxes[box_idx({roi_idx, 1})];
-        float x1 = boxes[box_idx({roi_idx, 2})];
-        float y1 = boxes[box_idx({roi_idx, 3})];
+    // layouts: boxes [rois_num, 4], deltas [rois_num, classes_num, 4], scores [rois_num, classes_num],
+    // refined boxes [classes_num, rois_num, 4], refined scores and areas [classes_num, rois_num]
+    parallel_for(rois_num, [&](int roi_idx) {
+        const float* box = boxes + roi_idx * 4;
+        float x0 = box[0];
+        float y0 = box[1];
+        float x1 = box[2];
+        float y1 = box[3];
 
         if (x1 - x0 <= 0 || y1 - y0 <= 0) {
-            continue;
+            return;
         }
 
         // width & height of box
@@ -70,10 +44,11 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
         const float ctr_y = y0 + 0.5f * hh;
 
         for (int class_idx = 1; class_idx < classes_num; ++class_idx) {
-            const float dx = deltas[delta_idx({roi_idx, class_idx, 0})] / weights[0];
-            const float dy = deltas[delta_idx({roi_idx, class_idx, 1})] / weights[1];
-            const float d_log_w = deltas[delta_idx({roi_idx, class_idx, 2})] / weights[2];
-            const float d_log_h = deltas[delta_idx({roi_idx, class_idx, 3})] / weights[3];
+            const float* delta = deltas + (roi_idx * classes_num + class_idx) * 4;
+            const float dx = delta[0] / weights[0];
+            const float dy = delta[1] / weights[1];
+            const float d_log_w = delta[2] / weights[2];
+            const float d_log_h = delta[3] / weights[3];
 
             // new center location according to deltas (dx, dy)
             const float pred_ctr_x = dx * ww + ctr_x;
@@ -99,16 +74,18 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
             const float box_w = x1_new - x0_new + coordinates_offset;
             const float box_h = y1_new - y0_new + coordinates_offset;
 
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 0})] = x0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 1})] = y0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 2})] = x1_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 3})] = y1_new;
+            const int refined_idx = class_idx * rois_num + roi_idx;
+            float* refined_box = refined_boxes + refined_idx * 4;
+            refined_box[0] = x0_new;
+            refined_box[1] = y0_new;
+            refined_box[2] = x1_new;
+            refined_box[3] = y1_new;
 
-            refined_boxes_areas[refined_score_idx({class_idx, roi_idx})] = box_w * box_h;
+            refined_boxes_areas[refined_idx] = box_w * box_h;
 
-            refined_scores[refined_score_idx({class_idx, roi_idx})] = scores[score_idx({roi_idx, class_idx})];
+            refined_scores[refined_idx] = scores[roi_idx * classes_num + class_idx];
         }
-    }
+    });
 }
 
 template <typename T>
@@ -294,8 +271,6 @@ void ExperimentalDetectronDetectionOutput::execute(dnnl::stream strm) {
     std::vector<float> refined_boxes(classes_num_ * rois_num * 4, 0);
     std::vector<float> refined_scores(classes_num_ * rois_num, 0);
     std::vector<float> refined_boxes_areas(classes_num_ * rois_num, 0);
-    Indexer refined_box_idx({classes_num_, rois_num, 4});
-    Indexer refined_score_idx({classes_num_, rois_num});
 
     refine_boxes(boxes, deltas, &deltas_weights_[0], scores,
                  &refined_boxes[0], &refined_boxes_areas[0], &refined_scores[0],
@@ -304,40 +279,42 @@ void ExperimentalDetectronDetectionOutput::execute(dnnl::stream strm) {
                  max_delta_log_wh_,
                  1.0f);
 
-    // Apply NMS class-wise.
-    std::vector<int> buffer(rois_num, 0);
+    // Apply NMS class-wise. The classes are independent, so every class gets its own part of the buffers
+    // and the detections are gathered in the class order afterwards.
+    std::vector<int> buffer(classes_num_ * rois_num, 0);
     std::vector<int> indices(classes_num_ * rois_num, 0);
     std::vector<int> detections_per_class(classes_num_, 0);
-    int total_detections_num = 0;
 
-    for (int class_idx = 1; class_idx < classes_num_; ++class_idx) {
-        nms_cf(&refined_scores[refined_score_idx({class_idx, 0})],
-               &refined_boxes[refined_box_idx({class_idx, 0, 0})],
-               &refined_boxes_areas[refined_score_idx({class_idx, 0})],
-               &buffer[0],
-               &indices[total_detections_num],
+    parallel_for(std::max(classes_num_ - 1, 0), [&](int i) {
+        const int class_idx = i + 1;
+        nms_cf(&refined_scores[class_idx * rois_num],
+               &refined_boxes[class_idx * rois_num * 4],
+               &refined_boxes_areas[class_idx * rois_num],
+               &buffer[class_idx * rois_num],
+               &indices[class_idx * rois_num],
                detections_per_class[class_idx],
                rois_num,
                -1,
                max_detections_per_class_,
                score_threshold_,
                nms_threshold_);
-        total_detections_num += detections_per_class[class_idx];
-    }
+    });
 
     // Leave only max_detections_per_image_ detections.
     // confidence, <class, index>
     std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+    int total_detections_num = 0;
+    for (int c = 0; c < classes_num_; ++c)
+        total_detections_num += detections_per_class[c];
+    conf_index_class_map.reserve(total_detections_num);
 
-    int indices_offset = 0;
     for (int c = 0; c < classes_num_; ++c) {
         int n = detections_per_class[c];
         for (int i = 0; i < n; ++i) {
-            int idx = indices[indices_offset + i];
-            float score = refined_scores[refined_score_idx({c, idx})];
+            int idx = indices[c * rois_num + i];
+            float score = refined_scores[c * rois_num + idx];
             conf_index_class_map.push_back(std::make_pair(score, std::make_pair(c, idx)));
         }
-        indices_offset += n;
     }
 
     assert(max_detections_per_image_ > 0);
@@ -360,10 +337,7 @@ void ExperimentalDetectronDetectionOutput::execute(dnnl::stream strm) {
         float score = detection.first;
         int cls = detection.second.first;
         int idx = detection.second.second;
-        output_boxes[4 * i + 0] = refined_boxes[refined_box_idx({cls, idx, 0})];
-        output_boxes[4 * i + 1] = refined_boxes[refined_box_idx({cls, idx, 1})];
-        output_boxes[4 * i + 2] = refined_boxes[refined_box_idx({cls, idx, 2})];
-        output_boxes[4 * i + 3] = refined_boxes[refined_box_idx({cls, idx, 3})];
+        cpu_memcpy(output_boxes + 4 * i, &refined_boxes[(cls * rois_num + idx) * 4], 4 * sizeof(output_boxes[0]));
         output_scores[i] = score;
         output_classes[i] = cls;
         ++i;
@@ -15,7 +15,9 @@
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "common/cpu_convert.h"
 #include <common/primitive_hashing_utils.hpp>
+#include "ie_parallel.hpp"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -176,6 +178,11 @@ void FullyConnected::getSupportedDescriptors() {
     }
     auto weightsDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(WEIGHTS_ID));
 
+    // the compressed weights are decompressed to FP32, so the FP32 primitive is used
+    if (withWeightsDecompression) {
+        inputDataType = memory::data_type::f32;
+    }
+
     //  We have to extend gemm_x8s8s32x_inner_product_fwd_t from oneDNN to support BF16 output data type
     if ((!one_of(inputDataType , memory::data_type::u8, memory::data_type::s8) || weightsDataType != memory::data_type::s8)
             && inputDataType != memory::data_type::bf16) {
@@ -227,7 +234,12 @@ void FullyConnected::prepareParams() {
     AttrPtr attr = std::make_shared<dnnl::primitive_attr>();
     setPostOps(*attr, dstMemPtr->getStaticDims());
 
-    DnnlMemoryDescCPtr weightDesc = wghMemPtr->GetDescWithType<DnnlMemoryDesc>();
+    DnnlMemoryDescCPtr weightDesc = nullptr;
+    if (withWeightsDecompression) {
+        weightDesc = std::make_shared<DnnlBlockedMemoryDesc>(Precision::FP32, Shape(wghMemPtr->getStaticDims()));
+    } else {
+        weightDesc = wghMemPtr->GetDescWithType<DnnlMemoryDesc>();
+    }
     DnnlMemoryDescCPtr biasDesc = nullptr;
     if (biasMemPtr) {
         biasDesc = biasMemPtr->GetDescWithType<DnnlMemoryDesc>();
@@ -302,7 +314,9 @@ void FullyConnected::prepareParams() {
     prim = result.first;
 
     primArgs[DNNL_ARG_SRC] = srcMemPtr->GetPrimitive();
-    primArgs[DNNL_ARG_WEIGHTS] = wghMemPtr->GetPrimitive();
+    // the handle of the decompressed weights is set before the execution
+    primArgs[DNNL_ARG_WEIGHTS] = withWeightsDecompression ? dnnl::memory(weightDesc->getDnnlDesc(), engine, DNNL_MEMORY_NONE)
+                                                          : wghMemPtr->GetPrimitive();
     primArgs[DNNL_ARG_DST] = dstMemPtr->GetPrimitive();
 
     if (withBiases) {
@@ -368,6 +382,10 @@ void FullyConnected::execute(dnnl::stream strm) {
         updateMemoryPtr(DNNL_ARG_SRC);
         updateMemoryPtr(DNNL_ARG_DST);
 
+        if (withWeightsDecompression) {
+            primArgs.at(DNNL_ARG_WEIGHTS).set_data_handle(decompressWeights());
+        }
+
         (*prim).execute(strm, primArgs);
     }
 }
@@ -376,6 +394,36 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+void FullyConnected::setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& shifts) {
+    if (scales.size() != shifts.size())
+        IE_THROW() << errorPrefix << " has inconsistent weights decompression parameters";
+    withWeightsDecompression = true;
+    decompressionScales = scales;
+    decompressionShifts = shifts;
+}
+
+void* FullyConnected::decompressWeights() {
+    const auto& weightsMemory = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    const auto& dims = weightsMemory.getStaticDims();
+    const size_t OC = dims[0];
+    const size_t IC = dims[1];
+    // the decompressed weights are only needed during the execution, so they are kept in the scratch pad of the graph
+    float* dst = static_cast<float*>(getScratchPad(OC * IC * sizeof(float)));
+    cpu_convert(weightsMemory.GetPtr(), dst, weightsMemory.getDesc().getPrecision(), Precision::FP32, OC * IC);
+    if (!decompressionScales.empty()) {
+        const bool perChannel = decompressionScales.size() > 1;
+        parallel_for(OC, [&](size_t oc) {
+            const float scale = decompressionScales[perChannel ? oc : 0];
+            const float shift = decompressionShifts[perChannel ? oc : 0];
+            float* row = dst + oc * IC;
+            for (size_t ic = 0; ic < IC; ic++) {
+                row[ic] = row[ic] * scale + shift;
+            }
+        });
+    }
+    return dst;
+}
+
 bool FullyConnected::canFuse(const NodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
@@ -502,8 +550,11 @@ void FullyConnected::createDescriptorInternal(const dnnl::memory::desc &inputDes
                                          DnnlExtensionUtils::GetPlainFormatByRank(normalizedOutDims.size()));
     }
 
-    dnnl::memory::desc wgh_candidate(DnnlExtensionUtils::convertToDnnlDims(getInputShapeAtPort(WEIGHTS_ID).getStaticDims()),
-                                       wdt, dnnl::memory::format_tag::any);
+    // the decompressed weights are plain, so the primitive takes them without reordering
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    dnnl::memory::desc wgh_candidate(DnnlExtensionUtils::convertToDnnlDims(weightsDims), wdt,
+                                     withWeightsDecompression ? DnnlExtensionUtils::GetPlainFormatByRank(weightsDims.size())
+                                                              : dnnl::memory::format_tag::any);
 
     if (withBiases) {
         dnnl::memory::desc bias_candidate(DnnlExtensionUtils::convertToDnnlDims(getInputShapeAtPort(BIAS_ID).getStaticDims()), bdt,
@@ -589,6 +640,11 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
 }
 
 std::shared_ptr<MemoryDesc> FullyConnected::getSrcMemDesc(dnnl::primitive_desc_iterator &primitive_desc_it, size_t idx) {
+    // the weights are taken compressed
+    if (idx == WEIGHTS_ID && withWeightsDecompression) {
+        return std::make_shared<CpuBlockedMemoryDesc>(getOriginalInputPrecisionAtPort(WEIGHTS_ID), getInputShapeAtPort(WEIGHTS_ID));
+    }
+
     auto desc = idx > 0 ? primitive_desc_it.weights_desc(idx - 1) : primitive_desc_it.src_desc(idx);
 
     if (getInputShapeAtPort(idx).getRank() == 3) {
@@ -56,6 +56,14 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    /**
+     * @brief Keeps the weights compressed: the weights of the compressed precision are decompressed on the fly
+     * to FP32 as w * scale + shift before the execution
+     * @param scales the per output channel or the single scale, empty if the weights are only converted
+     * @param shifts the per output channel or the single shift, the same size as the scales
+     */
+    void setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& shifts);
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -70,6 +78,12 @@ private:
 
     bool withBiases = false;
 
+    void* decompressWeights();
+
+    bool withWeightsDecompression = false;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
@@ -6,15 +6,18 @@
 #include "common/cpu_memcpy.h"
 #include <dnnl_extension_utils.h>
 
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <utils/general_utils.h>
 #include <ngraph/ops.hpp>
 #include <ie_parallel.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <blob_factory.hpp>
+#include <ie_system_conf.h>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
@@ -350,18 +353,59 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
-    if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
+    // the copy is shared between the streams of the NUMA node, it is not needed if the system has the only node,
+    // the constant data is used in place then (e.g. it refers the mapped model file and stays in the page cache)
+    static const bool singleNumaNode = InferenceEngine::getAvailableNUMANodes().size() == 1;
+    const bool useConstData = (!weightCache || singleNumaNode) && isBlobAligned() && !hasSubnormals() && !isWA();
+
+    if (useConstData) {
         auto ptr = new Memory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MemoryCPtr(ptr);
+    } else if (weightCache) {
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), [this] { return getContentKey(); }, cloneBlob, true,
+                                                   [this] (const Memory& memory) { return hasSameContent(memory); });
+        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
     } else {
         memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
     }
 }
 
+std::string Input::getContentKey() const {
+    if (!constOp || contentKeyCollision)
+        return {};
+
+    if (contentKey.empty()) {
+        const auto hash = WeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(constOp->get_data_ptr()),
+                                                              constOp->get_byte_size());
+        std::ostringstream key;
+        key << "const_" << constOp->get_element_type() << "_" << constOp->get_shape() << "_" << hash;
+        contentKey = key.str();
+    }
+    return contentKey;
+}
+
+bool Input::hasSameContent(const Memory& memory) const {
+    const auto size = constOp->get_byte_size();
+    const auto src = static_cast<const uint8_t*>(constOp->get_data_ptr());
+    const auto dst = static_cast<const uint8_t*>(memory.GetPtr());
+    bool same = memory.GetSize() >= size;
+    if (same && std::memcmp(dst, src, size) != 0) {
+        // the copy of the fp32 constant has the subnormals flushed to zero
+        same = constOp->get_element_type() == ngraph::element::f32;
+        for (size_t i = 0; same && i + sizeof(uint32_t) <= size; i += sizeof(uint32_t)) {
+            uint32_t srcValue, dstValue;
+            std::memcpy(&srcValue, src + i, sizeof(srcValue));
+            std::memcpy(&dstValue, dst + i, sizeof(dstValue));
+            same = srcValue == dstValue || ((srcValue & (0xFF << 23)) == 0 && (dstValue & 0x7FFFFFFF) == 0);
+        }
+    }
+    // the edges of the constant must not share the memory by the colliding key either
+    if (!same)
+        contentKeyCollision = true;
+    return same;
+}
+
 Input::Input(const Shape& shape, const InferenceEngine::Precision &prc, const std::string &name,
                                  const std::string &type, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(type, name, eng, cache) {
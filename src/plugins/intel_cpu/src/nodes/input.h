@@ -28,6 +28,11 @@ public:
 
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
+    /**
+     * @brief Describes the data of the constant node: precision, shape and data hash
+     * @return empty string for the non-constant nodes
+     */
+    std::string getContentKey() const;
 
     void executeDynamicImpl(dnnl::stream strm) override {}
     bool isExecutable() const override {
@@ -39,6 +44,7 @@ public:
 
 private:
     void cloneBlobIfRequired();
+    bool hasSameContent(const Memory& memory) const;
     void initSupportedPdDefault();
     void initSupportedPdFromMemDesc();
 
@@ -47,6 +53,8 @@ private:
     MemoryCPtr memoryPtr;
     MemoryDescPtr extMemDesc = nullptr;
     bool isMeanImage = false;
+    mutable std::string contentKey;
+    mutable bool contentKeyCollision = false;
 };
 
 }   // namespace node
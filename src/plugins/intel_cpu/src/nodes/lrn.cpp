@@ -140,7 +140,11 @@ void Lrn::getSupportedDescriptors() {
 
     const auto &parentShape = getInputShapeAtPort(0);
 
-    for (auto format : getAvailableFormatsForDims(parentShape)) {
+    auto formats = getAvailableFormatsForDims(parentShape);
+    // oneDNN has optimized implementations for the channels last layout as well, it saves reorders in nhwc graphs
+    if (parentShape.getRank() == 4)
+        formats.push_back(dnnl::memory::format_tag::nhwc);
+    for (auto format : formats) {
         auto in_candidate = std::make_shared<DnnlBlockedMemoryDesc>(parentShape, inputDataType, format);
         createDescriptor({in_candidate}, {});
     }
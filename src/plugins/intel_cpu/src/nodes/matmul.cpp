@@ -233,6 +233,29 @@ static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose) {
     return strides;
 }
 
+/**
+ * The input memory may be strided (e.g. the variable state appended in place by Concat), then its own strides are
+ * used instead of the dense ones
+ */
+static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose, const Memory& memory) {
+    const auto blockedDesc = memory.GetDescWithType<BlockedMemoryDesc>();
+    Shape denseShape = shape;
+    if (!blockedDesc->hasLayoutType(LayoutType::ncsp) ||
+        blockedDesc->getStrides() == getStridesAndModifyShape(denseShape, false))
+        return getStridesAndModifyShape(shape, transpose);
+
+    const auto getRank = shape.getRank();
+    auto strides = blockedDesc->getStrides();
+    if (transpose && getRank > 1) {
+        auto dims = shape.getStaticDims();
+        std::swap(dims[getRank - 2], dims[getRank - 1]);
+        shape = Shape{dims};
+        std::swap(strides[getRank - 2], strides[getRank - 1]);
+    }
+
+    return strides;
+}
+
 dnnl::memory::desc MatMul::getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc) {
     // oneDNN matmul requires shape for bias desc to be the same rank
     VectorDims biasDims(outMemDesc->getShape().getRank(), 1);
@@ -502,11 +525,11 @@ void MatMul::prepareParams() {
         const auto& src1Desc = src1MemPtr->getDesc();
 
         auto src0Shape = src0Desc.getShape();
-        auto src0Strides = getStridesAndModifyShape(src0Shape, transposeIn[0]);
+        auto src0Strides = getStridesAndModifyShape(src0Shape, transposeIn[0], *src0MemPtr);
         src0TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src0Desc.getPrecision(), src0Shape, src0Strides);
 
         auto src1Shape = src1Desc.getShape();
-        auto src1Strides = getStridesAndModifyShape(src1Shape, transposeIn[1]);
+        auto src1Strides = getStridesAndModifyShape(src1Shape, transposeIn[1], *src1MemPtr);
         src1TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src1Desc.getPrecision(), src1Shape, src1Strides);
     } else {
         attr = initPrimitiveAttr();
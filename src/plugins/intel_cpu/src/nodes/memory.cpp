@@ -30,11 +30,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -88,11 +83,6 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -124,6 +114,9 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+
+    currentState = dataStore;
+    nextState = dataStore;
 }
 
 /**
@@ -152,18 +145,52 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::setStateMemory(const MemoryPtr& current, const MemoryPtr& next) {
+    currentState = current;
+    nextState = next;
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
+    // the state is appended or passed through in the current buffer, it is kept there
+    stateUpdatedInPlace = new_state.GetData() == currentState->GetData();
+    if (stateUpdatedInPlace) {
+        if (isDynamicNode())
+            currentState->redefineDesc(new_state.getDescPtr());
+        return;
+    }
+
+    if (isDynamicNode())
+        nextState->redefineDesc(new_state.getDescPtr());
+
+    // the producer has written the state in place
+    if (new_state.GetData() == nextState->GetData())
+        return;
+
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           nextState.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*nextState, new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    // the output shape is the shape of the current state
+    if (isDynamicNode())
+        redefineOutputMemory({currentState->getStaticDims()});
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the consumers read the state in place, it may be strided along the axis (see Concat)
+    if (dstMemory.GetData() == currentState->GetData()) {
+        if (isDynamicNode() && currentState->getDescPtr() != dstMemory.getDescPtr()) {
+            for (auto& edge : getChildEdgesAtPort(0))
+                edge->getMemoryPtr()->redefineDesc(currentState->getDescPtr());
+        }
+        return;
+    }
+
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(currentState, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *currentState);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -175,6 +202,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput
         auto outputNode = dynamic_cast<MemoryOutput*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -190,6 +218,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerOutput(MemoryOutpu
         auto inputNode = dynamic_cast<MemoryInput*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
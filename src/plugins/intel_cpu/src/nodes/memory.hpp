@@ -68,6 +68,15 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
@@ -97,14 +106,43 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
+    MemoryOutput* getOutputNode() const {
+        return outputNode;
+    }
+
+    /**
+     * @brief Sets the state buffers of the infer request: the node reads the current one and the sibling
+     * MemoryOutput writes the next one. The copy is skipped if the edge is bound to the buffer already.
+     */
+    void setStateMemory(const MemoryPtr& current, const MemoryPtr& next);
     void storeState(const Memory& mem);
+    /**
+     * @brief Checks whether the last stored state was written into the current buffer (e.g. appended in place by
+     * Concat), then the buffers must not be swapped.
+     */
+    bool isStateUpdatedInPlace() const {
+        return stateUpdatedInPlace;
+    }
     MemoryPtr getStore();
  private:
     MemoryPtr dataStore;
+    MemoryPtr currentState;
+    MemoryPtr nextState;
+    bool stateUpdatedInPlace = false;
+    /**
+     * @brief keeps reference to output sibling node
+     */
+    MemoryOutput* outputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
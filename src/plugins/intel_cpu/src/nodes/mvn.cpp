@@ -5,6 +5,7 @@
 #include "mvn.h"
 
 #include <algorithm>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -840,9 +841,29 @@ MVN::MVNExecutor::MVNExecutor(const MVNAttrs& mvnAttrs)
       src_data_size(mvnAttrs.src_prc.size()),
       dst_data_size(mvnAttrs.dst_prc.size()) {}
 
+template <typename KernelT, typename... Args>
+std::shared_ptr<KernelT> MVN::MVNJitExecutor::createKernel(const JitCodeCache::Ptr& jitCodeCache, const std::string& key,
+                                                           const Args&... args) {
+    auto kernel = std::make_shared<KernelT>(args...);
+    if (!jitCodeCache || key.empty()) {
+        kernel->create_ker();
+        return kernel;
+    }
+
+    auto code = jitCodeCache->getOrCreate(key, [&]() -> std::shared_ptr<jit_generator> {
+        auto generated = std::make_shared<KernelT>(args...);
+        generated->create_ker();
+        return generated;
+    });
+    kernel->ker_ = reinterpret_cast<decltype(kernel->ker_)>(code->get());
+    kernelsCode.push_back(code);
+    return kernel;
+}
+
 MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
-                                              const dnnl::primitive_attr& attr):
-                                              MVNExecutor(mvnAttrs) {
+                                    const dnnl::primitive_attr& attr,
+                                    const JitCodeCache::Ptr& jitCodeCache):
+                                    MVNExecutor(mvnAttrs) {
     auto jcp = jit_mvn_config_params();
     jcp.src_prc = mvnAttrs.src_prc;
     jcp.dst_prc = mvnAttrs.dst_prc;
@@ -853,40 +874,57 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
     jcp.across_channels = mvnAttrs.execAcrossChannels_;
     int N = 0;
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = mvnAttrs.shape5D;
+
+    // the code of the kernels depends only on the jcp fields, except the post ops of mvn_kernel which are not cached
+    const bool hasPostOps = attr.get()->post_ops_.len() != 0;
+    auto kernelKey = [&](const char* name, cpu_isa_t isa, bool cacheable) {
+        if (!jitCodeCache || !cacheable)
+            return std::string();
+        std::ostringstream key;
+        key << name << "_isa" << static_cast<uint64_t>(isa)
+            << "_pl" << jcp.planar_layout << "_ac" << jcp.across_channels << "_nv" << jcp.normalize_variance
+            << "_" << jcp.src_prc.name() << "_" << jcp.dst_prc.name()
+            << "_" << jcp.src_data_size << "_" << jcp.dst_data_size
+            << "_" << jcp.C << "x" << jcp.D << "x" << jcp.H << "x" << jcp.W;
+        return key.str();
+    };
+
     if (mayiuse(cpu::x64::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+        mvn_kernel = createKernel<jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>>(jitCodeCache,
+            kernelKey("mvn", cpu::x64::avx512_common, !hasPostOps), jcp, *attr.get());
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
+        mvn_mean_kernel = createKernel<jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>>(jitCodeCache,
+            kernelKey("mvn_mean", cpu::x64::avx512_common, true), jcp);
         if (mvnAttrs.normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
+            mvn_variance_kernel = createKernel<jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>>(jitCodeCache,
+                kernelKey("mvn_variance", cpu::x64::avx512_common, true), jcp);
         }
     } else if (mayiuse(cpu::x64::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+        mvn_kernel = createKernel<jit_uni_mvn_kernel_f32<cpu::x64::avx2>>(jitCodeCache,
+            kernelKey("mvn", cpu::x64::avx2, !hasPostOps), jcp, *attr.get());
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+        mvn_mean_kernel = createKernel<jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>>(jitCodeCache,
+            kernelKey("mvn_mean", cpu::x64::avx2, true), jcp);
         if (mvnAttrs.normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+            mvn_variance_kernel = createKernel<jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>>(jitCodeCache,
+                kernelKey("mvn_variance", cpu::x64::avx2, true), jcp);
         }
     } else if (mayiuse(cpu::x64::sse41)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+        mvn_kernel = createKernel<jit_uni_mvn_kernel_f32<cpu::x64::sse41>>(jitCodeCache,
+            kernelKey("mvn", cpu::x64::sse41, !hasPostOps), jcp, *attr.get());
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+        mvn_mean_kernel = createKernel<jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>>(jitCodeCache,
+            kernelKey("mvn_mean", cpu::x64::sse41, true), jcp);
         if (mvnAttrs.normalizeVariance_) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+            mvn_variance_kernel = createKernel<jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>>(jitCodeCache,
+                kernelKey("mvn_variance", cpu::x64::sse41, true), jcp);
         }
     } else {
         IE_THROW() << "Can't create jit MVN kernel";
     }
-
-    if (mvn_kernel)
-        mvn_kernel->create_ker();
-    if (mvn_mean_kernel)
-        mvn_mean_kernel->create_ker();
-    if (mvn_variance_kernel)
-        mvn_variance_kernel->create_ker();
 }
 
 void MVN::MVNJitExecutor::exec(const uint8_t *src_data, uint8_t *dst_data, const void *post_ops_data_) {
@@ -936,7 +974,7 @@ void MVN::prepareParams() {
     auto builder = [&](const MVNKey& key) -> std::shared_ptr<MVNExecutor> {
         std::shared_ptr<MVNExecutor> executor;
         if (mayiuse(cpu::x64::sse41)) {
-            executor = std::make_shared<MVNJitExecutor>(key.mvnAttrs, key.attr);
+            executor = std::make_shared<MVNJitExecutor>(key.mvnAttrs, key.attr, getJitCodeCache());
         } else {
             executor = std::make_shared<MVNRefExecutor>(key.mvnAttrs);
         }
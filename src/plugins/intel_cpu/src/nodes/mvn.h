@@ -5,6 +5,7 @@
 #pragma once
 
 #include <node.h>
+#include "cache/jit_code_cache.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -145,7 +146,8 @@ private:
     class MVNJitExecutor : public MVNExecutor {
         public:
             MVNJitExecutor(const MVNAttrs& mvnAttrs,
-                           const dnnl::primitive_attr &attr);
+                           const dnnl::primitive_attr &attr,
+                           const JitCodeCache::Ptr& jitCodeCache);
 
             void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
 
@@ -153,9 +155,14 @@ private:
             void mvn_pln(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_);
             void mvn_blk(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_);
 
+            template <typename KernelT, typename... Args>
+            std::shared_ptr<KernelT> createKernel(const JitCodeCache::Ptr& jitCodeCache, const std::string& key, const Args&... args);
+
             std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_mean_kernel;
             std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_variance_kernel;
             std::shared_ptr<jit_uni_mvn_kernel> mvn_kernel;
+            // code of the kernels loaded from the persistent cache
+            std::vector<JitCodePtr> kernelsCode;
     };
 
     class MVNRefExecutor : public MVNExecutor {
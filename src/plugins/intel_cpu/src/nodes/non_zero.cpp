@@ -5,13 +5,141 @@
 #include "non_zero.h"
 #include <ngraph/opsets/opset3.hpp>
 #include <utils/bfloat16.hpp>
+#include "ie_parallel.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_non_zero_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+// stream compaction of the element indices with the mask of non zero elements (vpcompressd)
+struct jit_non_zero_kernel_avx512 : public jit_uni_non_zero_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_non_zero_kernel_avx512)
+
+    explicit jit_non_zero_kernel_avx512(jit_non_zero_config_params jcp) : jit_uni_non_zero_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_dst_start, reg_dst);
+
+        vpbroadcastd(vmm_index, ptr[reg_params + GET_OFF(start_index)]);
+        mov(reg_tmp, l_iota);
+        vpaddd(vmm_index, vmm_index, ptr[reg_tmp]);
+        mov(reg_tmp.cvt32(), vlen);
+        vpbroadcastd(vmm_step, reg_tmp.cvt32());
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        Label main_loop, tail, exit;
+        L(main_loop);
+        {
+            cmp(reg_work_amount, vlen);
+            jl(tail, T_NEAR);
+
+            compress(false);
+
+            add(reg_src, vlen * jcp_.src_prc.size());
+            sub(reg_work_amount, vlen);
+            jmp(main_loop, T_NEAR);
+        }
+
+        L(tail);
+        cmp(reg_work_amount, 0);
+        je(exit, T_NEAR);
+        mov(reg_tmp.cvt32(), 0xffff);
+        bzhi(reg_tmp.cvt32(), reg_tmp.cvt32(), reg_work_amount.cvt32());
+        kmovw(k_tail_mask, reg_tmp.cvt32());
+        compress(true);
+
+        L(exit);
+        sub(reg_dst, reg_dst_start);
+        shr(reg_dst, 2);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(count)]);
+        mov(ptr[reg_tmp], reg_dst);
+
+        this->postamble();
+
+        align(64);
+        L(l_iota);
+        for (int i = 0; i < vlen; i++)
+            dd(i);
+    }
+
+private:
+    static constexpr int vlen = 16;
+    // predicate of the integer comparison
+    static constexpr int cmp_ne = 4;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_dst_start = r11;
+    Xbyak::Reg64 reg_tmp = r12;
+
+    Xbyak::Zmm vmm_src = Xbyak::Zmm(0);
+    Xbyak::Zmm vmm_index = Xbyak::Zmm(1);
+    Xbyak::Zmm vmm_step = Xbyak::Zmm(2);
+    Xbyak::Zmm vmm_zero = Xbyak::Zmm(3);
+    Xbyak::Opmask k_tail_mask = Xbyak::Opmask(1);
+    Xbyak::Opmask k_non_zero = Xbyak::Opmask(2);
+
+    Xbyak::Label l_iota;
+
+    void compress(bool isTail) {
+        // the masked out lanes are zeroed, so they never get into the non zero mask
+        const auto src = isTail ? vmm_src | k_tail_mask | T_z : vmm_src;
+        const auto addr = ptr[reg_src];
+        switch (jcp_.src_prc) {
+            case Precision::FP32:
+                vmovups(src, addr);
+                vcmpps(k_non_zero, vmm_src, vmm_zero, _cmp_neq_uq);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(src, addr);
+                vpslld(vmm_src, vmm_src, 16);
+                vcmpps(k_non_zero, vmm_src, vmm_zero, _cmp_neq_uq);
+                break;
+            case Precision::I32:
+            case Precision::U32:
+                vmovdqu32(src, addr);
+                vpcmpd(k_non_zero, vmm_src, vmm_zero, cmp_ne);
+                break;
+            case Precision::I8:
+                vpmovsxbd(src, addr);
+                vpcmpd(k_non_zero, vmm_src, vmm_zero, cmp_ne);
+                break;
+            case Precision::U8:
+                vpmovzxbd(src, addr);
+                vpcmpd(k_non_zero, vmm_src, vmm_zero, cmp_ne);
+                break;
+            default:
+                IE_THROW() << "NonZero kernel doesn't support precision " << jcp_.src_prc.name();
+        }
+
+        vpcompressd(ptr[reg_dst] | k_non_zero, vmm_index);
+        kmovw(reg_tmp.cvt32(), k_non_zero);
+        popcnt(reg_tmp.cvt32(), reg_tmp.cvt32());
+        lea(reg_dst, ptr[reg_dst + reg_tmp * sizeof(int)]);
+        vpaddd(vmm_index, vmm_index, vmm_step);
+    }
+};
+
 bool NonZero::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (op->get_type_info() != ngraph::op::v3::NonZero::get_type_info_static()) {
@@ -61,22 +189,69 @@ void NonZero::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref);
 }
 
+void NonZero::createPrimitive() {
+    const auto& inPrc = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].getMemDesc()->getPrecision();
+    if (mayiuse(avx512_core)) {
+        kernel.reset(new jit_non_zero_kernel_avx512({inPrc}));
+        kernel->create_ker();
+    }
+    Node::createPrimitive();
+}
+
 template <typename T>
-size_t NonZero::getNonZeroElementsCount(const T* src, const Shape& inShape) {
+size_t NonZero::getNonZeroElementsCount(const T* src, size_t start, size_t end) {
     T zero = 0;
     size_t count = 0;
-    size_t inSize = inShape.getElementsCount();
-    if (inShape.getRank() == 0) {
-        if (src[0] != zero)
-            count = 1;
-    } else {
-        for (size_t i = 0; i < inSize; i++) {
-            if (src[i] != zero)
-                count++;
-        }
+    for (size_t i = start; i < end; i++) {
+        if (src[i] != zero)
+            count++;
     }
     return count;
 }
+
+template <typename T>
+void NonZero::fillIndices(const T* src, size_t start, size_t end, const VectorDims& inDims, int* dst, size_t offset, size_t nonZeroCount) {
+    const size_t inRank = inDims.size();
+    const size_t innerDim = inDims[inRank - 1];
+    int* dstInner = dst + (inRank - 1) * nonZeroCount;
+
+    VectorDims coords(inRank, 0);
+    for (size_t j = inRank, rest = start; j-- > 0; rest /= inDims[j])
+        coords[j] = rest % inDims[j];
+
+    // the innermost coordinates are computed for a row segment at once, the outer ones are the same for the segment
+    for (size_t i = start; i < end;) {
+        const size_t segmentEnd = std::min(end, i + innerDim - coords[inRank - 1]);
+        size_t written = 0;
+        if (kernel) {
+            jit_non_zero_call_args args;
+            args.src = src + i;
+            args.dst = dstInner + offset;
+            args.work_amount = segmentEnd - i;
+            args.start_index = static_cast<int>(coords[inRank - 1]);
+            args.count = &written;
+            (*kernel)(&args);
+        } else {
+            T zero = 0;
+            for (size_t k = i; k < segmentEnd; k++) {
+                if (src[k] != zero)
+                    dstInner[offset + written++] = static_cast<int>(coords[inRank - 1] + k - i);
+            }
+        }
+        for (size_t j = 0; j + 1 < inRank; j++)
+            std::fill_n(dst + j * nonZeroCount + offset, written, static_cast<int>(coords[j]));
+        offset += written;
+        i = segmentEnd;
+
+        coords[inRank - 1] = 0;
+        for (size_t j = inRank - 1; j-- > 0;) {
+            if (++coords[j] < inDims[j])
+                break;
+            coords[j] = 0;
+        }
+    }
+}
+
 namespace {
 struct NonZeroContext {
     NonZero &node;
@@ -111,33 +286,49 @@ void NonZero::executeSpecified() {
     auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     Shape inShape = getParentEdgeAt(0)->getMemory().GetShape();
     size_t inRank = inShape.getRank();
-    size_t nonZeroCount = getNonZeroElementsCount(src, inShape);
+    size_t inSize = inShape.getElementsCount();
+
+    if (inRank == 0) {
+        size_t nonZeroCount = src[0] != zero ? 1 : 0;
+        if (isDynamicNode()) {
+            VectorDims newDims{inRank, nonZeroCount};
+            redefineOutputMemory({newDims});
+        }
+        if (nonZeroCount != 0)
+            reinterpret_cast<int *>(dstMemPtr->GetPtr())[0] = 0;
+        return;
+    }
+
+    // Two passes over the same split of the input: the non zero elements are counted per thread, then
+    // every thread writes the coordinates of its elements starting from the exclusive prefix sum of the counts.
+    constexpr size_t minWorkPerThread = 4096;
+    const int nthr = static_cast<int>(std::max<size_t>(1, std::min<size_t>(parallel_get_max_threads(), inSize / minWorkPerThread)));
+    std::vector<size_t> offsets(nthr + 1, 0);
+
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(inSize, nthr, ithr, start, end);
+        offsets[ithr + 1] = getNonZeroElementsCount(src, start, end);
+    });
+    for (int i = 0; i < nthr; i++)
+        offsets[i + 1] += offsets[i];
+    const size_t nonZeroCount = offsets[nthr];
 
     if (isDynamicNode()) {
         VectorDims newDims{inRank, nonZeroCount};
         redefineOutputMemory({newDims});
     }
-    int *dst = reinterpret_cast<int *>(dstMemPtr->GetPtr());
-    size_t inSize = inShape.getElementsCount();
-    auto srcStrides = getParentEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     if (nonZeroCount == 0)
         return;
-    if (inShape.getRank() == 0) {
-        dst[0] = 0;
-    } else {
-        size_t colIndex = 0, outIndex = 0;
-        for (size_t i = 0; i < inSize; i++) {
-            if (src[i] != zero) {
-                size_t temp = i;
-                for (size_t j = 0; j < inRank; j++) {
-                    outIndex = j * nonZeroCount + colIndex;
-                    dst[outIndex] = temp / srcStrides[j];
-                    temp = temp % srcStrides[j];
-                }
-                colIndex++;
-            }
-        }
-    }
+
+    int *dst = reinterpret_cast<int *>(dstMemPtr->GetPtr());
+    const auto& inDims = inShape.getStaticDims();
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(inSize, nthr, ithr, start, end);
+        if (start < end)
+            fillIndices(src, start, end, inDims, dst, offsets[ithr], nonZeroCount);
+    });
 }
 
 bool NonZero::created() const {
@@ -14,12 +14,44 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_non_zero_config_params {
+    InferenceEngine::Precision src_prc;
+};
+
+struct jit_non_zero_call_args {
+    const void* src;
+    int* dst;
+    size_t work_amount;
+    int start_index;
+    size_t* count;
+};
+
+/**
+ * Writes start_index + i for every non zero src[i], i < work_amount, into dst and stores the number of written values in count
+ */
+struct jit_uni_non_zero_kernel {
+    void (*ker_)(const jit_non_zero_call_args *);
+
+    void operator()(const jit_non_zero_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_non_zero_kernel(jit_non_zero_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_non_zero_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_non_zero_config_params jcp_;
+};
+
 class NonZero : public Node {
 public:
   NonZero(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
     bool needShapeInfer() const override {return false;};
@@ -36,7 +68,11 @@ private:
     template<typename T>
     struct NonZeroExecute;
     template <typename T>
-    size_t getNonZeroElementsCount(const T* arg, const Shape& arg_shape);
+    size_t getNonZeroElementsCount(const T* src, size_t start, size_t end);
+    template <typename T>
+    void fillIndices(const T* src, size_t start, size_t end, const VectorDims& inDims, int* dst, size_t offset, size_t nonZeroCount);
+
+    std::shared_ptr<jit_uni_non_zero_kernel> kernel;
 };
 
 }   // namespace node
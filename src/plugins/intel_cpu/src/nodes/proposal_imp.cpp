@@ -10,7 +10,7 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
-#if defined(HAVE_AVX2)
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
 #include "ie_parallel.hpp"
@@ -140,6 +140,14 @@ static void nms_cpu(const int num_boxes, int is_dead[],
 
     std::memset(is_dead, 0, num_boxes * sizeof(int));
 
+#if defined(HAVE_AVX512F)
+    const __m512  vc_fone_16 = _mm512_set1_ps(coordinates_offset);
+    const __m512i vc_ione_16 = _mm512_set1_epi32(1);
+    const __m512  vc_zero_16 = _mm512_setzero_ps();
+
+    const __m512 vc_nms_thresh_16 = _mm512_set1_ps(nms_thresh);
+#endif
+
 #if defined(HAVE_AVX2)
     __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
     __m256i vc_ione = _mm256_set1_epi32(1);
@@ -158,6 +166,49 @@ static void nms_cpu(const int num_boxes, int is_dead[],
 
         int tail = box + 1;
 
+#if defined(HAVE_AVX512F)
+        // the same operations as in the AVX2 and scalar parts below, so the result doesn't depend on the number of lanes
+        const __m512 vx0i_16 = _mm512_set1_ps(x0[box]);
+        const __m512 vy0i_16 = _mm512_set1_ps(y0[box]);
+        const __m512 vx1i_16 = _mm512_set1_ps(x1[box]);
+        const __m512 vy1i_16 = _mm512_set1_ps(y1[box]);
+
+        const __m512 vA_width_16  = _mm512_sub_ps(vx1i_16, vx0i_16);
+        const __m512 vA_height_16 = _mm512_sub_ps(vy1i_16, vy0i_16);
+        const __m512 vA_area_16   = _mm512_mul_ps(_mm512_add_ps(vA_width_16, vc_fone_16), _mm512_add_ps(vA_height_16, vc_fone_16));
+
+        for (; tail <= num_boxes - 16; tail += 16) {
+            __m512 vx0j = _mm512_loadu_ps(x0 + tail);
+            __m512 vy0j = _mm512_loadu_ps(y0 + tail);
+            __m512 vx1j = _mm512_loadu_ps(x1 + tail);
+            __m512 vy1j = _mm512_loadu_ps(y1 + tail);
+
+            __m512 vx0 = _mm512_max_ps(vx0i_16, vx0j);
+            __m512 vy0 = _mm512_max_ps(vy0i_16, vy0j);
+            __m512 vx1 = _mm512_min_ps(vx1i_16, vx1j);
+            __m512 vy1 = _mm512_min_ps(vy1i_16, vy1j);
+
+            __m512 vwidth  = _mm512_add_ps(_mm512_sub_ps(vx1, vx0), vc_fone_16);
+            __m512 vheight = _mm512_add_ps(_mm512_sub_ps(vy1, vy0), vc_fone_16);
+            __m512 varea = _mm512_mul_ps(_mm512_max_ps(vc_zero_16, vwidth), _mm512_max_ps(vc_zero_16, vheight));
+
+            __m512 vB_width  = _mm512_sub_ps(vx1j, vx0j);
+            __m512 vB_height = _mm512_sub_ps(vy1j, vy0j);
+            __m512 vB_area   = _mm512_mul_ps(_mm512_add_ps(vB_width, vc_fone_16), _mm512_add_ps(vB_height, vc_fone_16));
+
+            __m512 vdivisor = _mm512_sub_ps(_mm512_add_ps(vA_area_16, vB_area), varea);
+            __m512 vintersection_area = _mm512_div_ps(varea, vdivisor);
+
+            __mmask16 vcmp = _mm512_cmp_ps_mask(vx0i_16, vx1j, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vy0i_16, vy1j, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vx0j, vx1i_16, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vy0j, vy1i_16, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vc_nms_thresh_16, vintersection_area, _CMP_LT_OS);
+
+            _mm512_mask_storeu_epi32(is_dead + tail, vcmp, vc_ione_16);
+        }
+#endif
+
 #if defined(HAVE_AVX2)
         __m256 vx0i = _mm256_set1_ps(x0[box]);
         __m256 vy0i = _mm256_set1_ps(y0[box]);
@@ -336,9 +387,6 @@ void proposal_exec(const float* input0, const float* input1,
     // number of top-n proposals before NMS
     const int pre_nms_topn = std::min<int>(num_proposals, conf.pre_nms_topn_);
 
-    // number of final RoIs
-    int num_rois = 0;
-
     // enumerate all proposals
     //   num_proposals = num_anchors * H * W
     //   (x1, y1, x2, y2, score) for each proposal
@@ -350,14 +398,15 @@ void proposal_exec(const float* input0, const float* input1,
         float y1;
         float score;
     };
-    std::vector<ProposalBox> proposals_(num_proposals);
     const int unpacked_boxes_buffer_size = store_prob ? 5 * pre_nms_topn : 4 * pre_nms_topn;
-    std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
-    std::vector<int> is_dead(pre_nms_topn);
 
-    // Execute
-    int nn = dims0[0];
-    for (int n = 0; n < nn; ++n) {
+    auto process_image = [&](int n, int* roi_indices_item) {
+        std::vector<ProposalBox> proposals_(num_proposals);
+        std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
+        std::vector<int> is_dead(pre_nms_topn);
+        // number of final RoIs
+        int num_rois = 0;
+
         enumerate_proposals_cpu(p_bottom_item + num_proposals + n * num_proposals * 2,
                                 p_d_anchor_item + n * num_proposals * 4,
                                 anchors, reinterpret_cast<float *>(&proposals_[0]),
@@ -371,13 +420,25 @@ void proposal_exec(const float* input0, const float* input1,
                           });
 
         unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn, store_prob);
-        nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], roi_indices, &num_rois, 0, conf.nms_thresh_,
+        nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], roi_indices_item, &num_rois, 0, conf.nms_thresh_,
                 conf.post_nms_topn_, conf.coordinates_offset);
 
         float* p_probs = store_prob ? p_prob_item + n * conf.post_nms_topn_ : nullptr;
-        retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], roi_indices,
+        retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], roi_indices_item,
                           p_roi_item + n * conf.post_nms_topn_ * 5,
                           conf.post_nms_topn_, conf.normalize_, img_H, img_W, conf.clip_after_nms, p_probs);
+    };
+
+    // Execute
+    // The sort and NMS of an image are sequential, so the images of the batch are processed in parallel.
+    const int nn = dims0[0];
+    if (nn == 1) {
+        process_image(0, roi_indices);
+    } else {
+        parallel_for(nn, [&](int n) {
+            std::vector<int> roi_indices_item(conf.post_nms_topn_);
+            process_image(n, roi_indices_item.data());
+        });
     }
 }
 
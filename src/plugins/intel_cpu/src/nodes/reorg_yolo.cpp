@@ -7,6 +7,7 @@
 #include <ngraph/opsets/opset2.hpp>
 #include "ie_parallel.hpp"
 #include "reorg_yolo.h"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
 
@@ -49,8 +50,13 @@ void ReorgYolo::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32}},
-                         {{LayoutType::ncsp, Precision::FP32}},
+    // the node only moves the elements, so the data is processed in the original precision without conversions
+    Precision precision = getOriginalInputPrecisionAtPort(0);
+    if (!one_of(precision.size(), 1u, 2u, 4u))
+        precision = Precision::FP32;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, precision}},
+                         {{LayoutType::ncsp, precision}},
                          impl_desc_type::ref_any);
 }
 
@@ -59,37 +65,40 @@ void ReorgYolo::executeDynamicImpl(dnnl::stream strm) {
 }
 
 void ReorgYolo::execute(dnnl::stream strm) {
-    const auto *src_data = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
-    auto *dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto *src_data = srcMemory.GetPtr();
+    auto *dst_data = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr();
+
+    switch (srcMemory.getDesc().getPrecision().size()) {
+        case 1: reorg(static_cast<const uint8_t*>(src_data), static_cast<uint8_t*>(dst_data)); break;
+        case 2: reorg(static_cast<const uint16_t*>(src_data), static_cast<uint16_t*>(dst_data)); break;
+        case 4: reorg(static_cast<const uint32_t*>(src_data), static_cast<uint32_t*>(dst_data)); break;
+        default: IE_THROW() << errorPrefix << " has unsupported precision: " << srcMemory.getDesc().getPrecision();
+    }
+}
 
+template <typename T>
+void ReorgYolo::reorg(const T* src_data, T* dst_data) {
     const auto &inDims = getParentEdgeAt(0)->getMemory().getStaticDims();
-    int IW = (inDims.size() > 3) ? inDims[3] : 1;
-    int IH = (inDims.size() > 2) ? inDims[2] : 1;
-    int IC = (inDims.size() > 1) ? inDims[1] : 1;
-    int B  = (inDims.size() > 0) ? inDims[0] : 1;
-
-    int ic_off = IC / (stride * stride);
-    int ih_off = IH * stride;
-    int iw_off = IW * stride;
-    for (int b = 0; b < B; b++) {
-        for (int ic = 0; ic < IC; ic++) {
-            for (int ih = 0; ih < IH; ih++) {
-                for (int iw = 0; iw < IW; iw++) {
-                    int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
-
-                    int oc = ic % ic_off;
-                    int offset = ic / ic_off;
-
-                    int ow = iw * stride + offset % stride;
-                    int oh = ih * stride + offset / stride;
-
-                    int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
-
-                    dst_data[dstIndex] = src_data[srcIndex];
-                }
-            }
-        }
-    }
+    const size_t IW = (inDims.size() > 3) ? inDims[3] : 1;
+    const size_t IH = (inDims.size() > 2) ? inDims[2] : 1;
+    const size_t IC = (inDims.size() > 1) ? inDims[1] : 1;
+    const size_t B  = (inDims.size() > 0) ? inDims[0] : 1;
+
+    const size_t ic_off = IC / (stride * stride);
+    const size_t ih_off = IH * stride;
+    const size_t iw_off = IW * stride;
+    // every destination row is a strided gather from a single source row
+    parallel_for3d(B, IC, IH, [&](size_t b, size_t ic, size_t ih) {
+        const size_t oc = ic % ic_off;
+        const size_t offset = ic / ic_off;
+        const size_t oh = ih * stride + offset / stride;
+
+        const T* src_row = src_data + ((b * ic_off + oc) * ih_off + oh) * iw_off + offset % stride;
+        T* dst_row = dst_data + ((b * IC + ic) * IH + ih) * IW;
+        for (size_t iw = 0; iw < IW; iw++)
+            dst_row[iw] = src_row[iw * stride];
+    });
 }
 
 bool ReorgYolo::created() const {
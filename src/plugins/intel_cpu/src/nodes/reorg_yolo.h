@@ -25,7 +25,10 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
-    int stride;
+    template <typename T>
+    void reorg(const T* src_data, T* dst_data);
+
+    size_t stride;
 
     std::string errorPrefix;
 };
@@ -71,11 +71,13 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // reductions are performed over the innermost dimension of the planar layout only
+    const bool hasReductions = snippet->has_reductions();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -204,6 +206,10 @@ bool Snippet::created() const {
 }
 
 bool Snippet::canBeInPlace() const {
+    // the inputs are read by several passes over the row, so they can't be overwritten by the first one
+    if (snippet->has_reductions())
+        return false;
+
     if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Type::Input) {
         return false;
     }
@@ -336,8 +342,9 @@ void Snippet::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
+            // the reduced dimension can't be extended
+            bool canCollapse = !snippet->has_reductions();
+            for (size_t i = 0; canCollapse && i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
@@ -397,7 +404,12 @@ void Snippet::define_schedule() {
 
             for (size_t i = 0; i < offsets_out.size(); i++) {
                 int64_t offset = offsets_out[i][tensorRank - 2];
-                sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+                // reduced values are stored without the pointer shifts
+                if (dims_out[i].back() == 1) {
+                    sch_offsets_out[i] = offset;
+                } else {
+                    sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+                }
             }
         }
     };
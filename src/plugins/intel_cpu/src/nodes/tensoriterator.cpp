@@ -4,6 +4,8 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -24,6 +26,11 @@ namespace node {
 
 #define THROW_ERROR IE_THROW() << getTypeStr() << " layer with name '" << getName() << "' "
 
+namespace {
+// the chunks written by the body in place are aligned to the cache line
+constexpr size_t inPlaceChunkAlignment = 64;
+}   // namespace
+
 static NodeConfig make_plain_config(const std::shared_ptr<ov::Node>& op) {
     NodeConfig config;
 
@@ -53,14 +60,16 @@ static NodeConfig make_plain_config(const std::shared_ptr<ov::Node>& op) {
     return config;
 }
 
-static void redefineToMemories(const std::vector<MemoryPtr>& to_mems, MemoryDescPtr new_desc) {
+static bool redefineToMemories(const std::vector<MemoryPtr>& to_mems, MemoryDescPtr new_desc) {
     const auto &currDesc = to_mems.front()->getDesc();
     if (currDesc.getShape().isDynamic() || currDesc.getShape().getStaticDims() != new_desc->getShape().getStaticDims()) {
         // TODO : check the entire dstMemPtrs usage considering the proper memory sharing
         for (size_t j = 0; j < to_mems.size(); j++) {
             to_mems[j]->redefineDesc(new_desc);
         }
+        return true;
     }
+    return false;
 }
 
 // this method get all memory ptrs of childs of one port to redefine descs for them
@@ -159,6 +168,59 @@ public:
     }
 };
 
+/**
+ * The body output is written right into its chunk of the concatenated output: the output memory refers the chunk of
+ * the iteration before the body is executed, so nothing is copied after the iteration.
+ */
+class PortIteratorInPlaceHelper : public PortMapHelper {
+public:
+    PortIteratorInPlaceHelper(const MemoryPtr &from, const MemoryPtr &to, const PortMap &slice_rule)
+                              : from(from), to(to) {
+        iter_count = to->getStaticDims()[slice_rule.axis] / std::abs(slice_rule.stride);
+        chunk_size = from->GetSize();
+        reversed = slice_rule.stride < 0;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        const auto chunk = reversed ? iter_count - 1 - iter : iter;
+        from->setDataHandle(static_cast<uint8_t *>(to->GetPtr()) + chunk * chunk_size);
+    }
+
+private:
+    MemoryPtr from;
+    MemoryPtr to;
+    size_t chunk_size;
+    int iter_count;
+    bool reversed;
+};
+
+/**
+ * The back edge without copying: the body output is written into one of two buffers, the next iteration reads it in
+ * place as the body input and writes its output into the other buffer.
+ */
+class BackEdgeSwapPortHelper : public PortMapHelper {
+public:
+    BackEdgeSwapPortHelper(const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) : from(from), to(to) {
+        for (auto& buffer : buffers) {
+            buffer = std::make_shared<Memory>(eng);
+            buffer->Create(from->getDesc());
+        }
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        if (iter != 0)
+            to->setDataHandle(from->GetData());
+        from->setDataHandle(to->GetData() == buffers[0]->GetData() ? buffers[1]->GetData() : buffers[0]->GetData());
+    }
+
+private:
+    MemoryPtr from;
+    MemoryPtr to;
+    std::array<MemoryPtr, 2> buffers;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const dnnl::engine& eng) {
@@ -228,89 +290,124 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
     elem_size = DnnlExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
-void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
+void DynamicBuffer::prepare(const dnnl::engine& eng, const int iter) {
+    // the first iteration of the execution writes the output to its own storage, the chunk geometry is known after it
     if (iter == 0) {
-        init(eng);
+        resetSource(eng);
         return;
     }
+    if (!in_place || count != 1 || chunk_size % inPlaceChunkAlignment != 0)
+        return;
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
-    move_data();
+    reserve(eng, num_chunks + 1);
+    from->setDataHandle(get_chunk_ptr(num_chunks));
+    source_redirected = true;
 }
 
-void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
+void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
+    if (iter == 0) {
+        init();
+    } else {
+        const auto abs_stride = std::abs(map_rule.stride);
+        if (from->getStaticDims()[map_rule.axis] != abs_stride)
+            IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+            " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+    }
 
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    if (source_redirected) {
+        // the body has written the output in place
+        if (from->GetPtr() == get_chunk_ptr(num_chunks)) {
+            num_chunks++;
+            return;
+        }
+        // the body has reallocated the output to its own storage
+        source_redirected = false;
+    }
 
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
-    auto dims = src_desc.dims();
+    reserve(eng, num_chunks + 1);
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_chunk_ptr(num_chunks), chunk_size,
+         capacity * chunk_size, count, chunk_size);
+    num_chunks++;
+}
 
-    if (dims[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-                   " is expected, but actual: " << dims[axis];
+void DynamicBuffer::resetSource(const dnnl::engine& eng) {
+    if (!source_redirected)
+        return;
 
-    count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, 1, std::multiplies<size_t>());
-    len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
+    const auto size = from->GetSize();
+    if (!mem_holder_source || mem_holder_source->get_desc().get_size() < size) {
+        const dnnl::memory::desc source_desc({static_cast<dnnl::memory::dim>(size)}, dnnl::memory::data_type::u8,
+                                             dnnl::memory::format_tag::a);
+        mem_holder_source = std::make_shared<dnnl::memory>(source_desc, eng);
+    }
+    from->setDataHandle(get_ptr(*mem_holder_source));
+    source_redirected = false;
 }
 
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
+void DynamicBuffer::init() {
     const auto axis = map_rule.axis;
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
 
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
-
-    if (from->getStaticDims()[axis] != abs_stride)
+    const auto& dims = from->getStaticDims();
+    if (dims[axis] != abs_stride)
         IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
-
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+                   " is expected, but actual: " << dims[axis];
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
+    const auto new_count = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const auto new_chunk_size = std::accumulate(dims.begin() + axis, dims.end(), elem_size, std::multiplies<size_t>());
+    // the buffer of the previous executions is reused if the chunks are the same
+    if (new_count != count || new_chunk_size != chunk_size) {
+        count = new_count;
+        chunk_size = new_chunk_size;
+        capacity = 0;
     }
-
-    return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
+    num_chunks = 0;
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::reserve(const dnnl::engine& eng, const size_t chunks) {
+    if (chunks <= capacity)
+        return;
+
+    // the body output must not refer the released buffer
+    resetSource(eng);
+
+    const auto new_capacity = std::max(chunks, 2 * capacity);
+    const dnnl::memory::desc new_buffer_desc({static_cast<dnnl::memory::dim>(count * new_capacity * chunk_size)},
+                                             dnnl::memory::data_type::u8, dnnl::memory::format_tag::a);
+    auto new_buffer = std::make_shared<dnnl::memory>(new_buffer_desc, eng);
+    if (num_chunks != 0)
+        copy(get_ptr(*mem_holder_buffer), get_ptr(*new_buffer), capacity * chunk_size, new_capacity * chunk_size,
+             count, num_chunks * chunk_size);
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
     mem_holder_buffer = new_buffer;
+    capacity = new_capacity;
 }
 
-void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+uint8_t* DynamicBuffer::get_chunk_ptr(const size_t chunk) {
+    return get_ptr(*mem_holder_buffer) + chunk * chunk_size;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
-    if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+    if (num_chunks != 0) {
+        auto dims = from->getStaticDims();
+        dims[map_rule.axis] = num_chunks * std::abs(map_rule.stride);
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        const auto src = get_ptr(*mem_holder_buffer);
+        auto dst = reinterpret_cast<uint8_t*>(to.front()->GetPtr());
+        const auto src_stride = capacity * chunk_size;
+        const auto dst_stride = num_chunks * chunk_size;
+        if (map_rule.stride > 0) {
+            copy(src, dst, src_stride, dst_stride, count, dst_stride);
+        } else {
+            // the chunk of the first iteration is the last one
+            parallel_for2d(count, num_chunks, [&](const size_t i, const size_t j) {
+                cpu_memcpy(&dst[i * dst_stride + (num_chunks - 1 - j) * chunk_size], &src[i * src_stride + j * chunk_size],
+                           chunk_size);
+            });
+        }
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -319,7 +416,8 @@ void DynamicBuffer::transfer(const Node* node) {
         redefineToMemories(to, desc);
     }
 
-    mem_holder_buffer.reset();
+    num_chunks = 0;
+    resetSource(node->getEngine());
 }
 
 void DynamicBuffer::copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len) {
@@ -492,6 +590,7 @@ void TensorIterator::prepareParams() {
     first_mappers.clear();
     before_mappers.clear();
     back_mappers.clear();
+    redirected_mems.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
         reshapeSubgraphInput();
@@ -553,6 +652,8 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
             mapper->execute(strm, i);
         for (auto &mapper : back_mappers)
             mapper->execute(strm, i);
+        for (auto& buffer : buffers)
+            buffer->prepare(eng, i);
 
         sub_graph.Infer();
 
@@ -561,6 +662,18 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
         for (auto& buffer : buffers)
             buffer->execute(eng, i);
 
+        // the body memories are defined after the first iteration
+        if (i == 0) {
+            redirected_mems.clear();
+            for (auto& buffer : buffers) {
+                const auto& source = buffer->getSource();
+                const bool in_place = canRedirectBodyMemory(source);
+                if (in_place)
+                    redirected_mems.push_back(source.get());
+                buffer->setInPlace(in_place);
+            }
+        }
+
         // on the last iteration we shouldn't reshape body inputs and init back edges
         if ((i + 1 != max_num_iter) && continue_cond)
             prepareDynamicBackEdges();
@@ -591,34 +704,85 @@ void TensorIterator::prepareOutputPorts() {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
-        else
+        } else if (canWriteChunkInPlace(from_mem, to_mem, map_rule)) {
+            redirected_mems.push_back(from_mem.get());
+            before_mappers.emplace_back(std::make_shared<PortIteratorInPlaceHelper>(from_mem, to_mem, map_rule));
+        } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
+        }
     }
 }
 
+bool TensorIterator::canWriteChunkInPlace(const MemoryPtr& from, const MemoryPtr& to, const PortMap& map_rule) {
+    // the back edge reads the output of the previous iteration before the output is redirected
+    if (std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) { return rule.from == map_rule.to; }))
+        return false;
+
+    // the chunks are contiguous if the dims before the axis are 1
+    const auto& dims = to->getStaticDims();
+    if (!std::all_of(dims.begin(), dims.begin() + map_rule.axis, [](size_t dim) { return dim == 1; }))
+        return false;
+
+    const auto& from_desc = from->getDesc();
+    const auto& to_desc = to->getDesc();
+    return from_desc.hasLayoutType(LayoutType::ncsp) && to_desc.hasLayoutType(LayoutType::ncsp) &&
+           from_desc.getPrecision() == to_desc.getPrecision() && to->GetPtr() == to->GetData() &&
+           from->GetSize() % inPlaceChunkAlignment == 0 && canRedirectBodyMemory(from);
+}
+
 void TensorIterator::prepareBackEdges() {
     const auto &eng = getEngine();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        if (from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+            from_mem->getDnnlMemoryMngr() != to_mem->getDnnlMemoryMngr() &&
+            canRedirectBodyMemory(from_mem) && canRedirectBodyMemory(to_mem)) {
+            redirected_mems.push_back(from_mem.get());
+            redirected_mems.push_back(to_mem.get());
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapPortHelper>(from_mem, to_mem, eng));
+        } else {
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        }
+    }
+}
+
+bool TensorIterator::canRedirectBodyMemory(const MemoryPtr& mem) {
+    if (!mem->getDesc().isDefined() ||
+        std::find(redirected_mems.begin(), redirected_mems.end(), mem.get()) != redirected_mems.end())
+        return false;
+
+    // the edges sharing the memory must refer the whole of it, e.g. the parts of the in-place Concat can't be moved
+    const auto mngr = mem->getDnnlMemoryMngr();
+    const auto size = mem->GetSize();
+    for (auto& edge : sub_graph.GetEdges()) {
+        const auto& edge_mem = edge->getMemoryPtr();
+        if (edge_mem->getDnnlMemoryMngr() != mngr)
+            continue;
+        if (edge->getParent()->isConstant() || !edge_mem->getDesc().isDefined() ||
+            edge_mem->GetSize() != size || edge_mem->GetPtr() != edge_mem->GetData())
+            return false;
     }
+    return true;
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
-    back_mappers.clear();
-    for (auto map_rule : backEdges) {
+    back_mappers.resize(backEdges.size());
+    for (size_t i = 0; i < backEdges.size(); i++) {
+        const auto& map_rule = backEdges[i];
         auto from_mem = output_mem[map_rule.from];
         auto to_mems = input_mems[map_rule.to];
 
-        redefineToMemories(to_mems, from_mem->getDescPtr());
-
-        // first memory is enough to get common memory ptr
-        back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mems.front(), eng));
+        // the reorder is created again only if the shape of the back edge is changed
+        const bool redefined = redefineToMemories(to_mems, from_mem->getDescPtr());
+        if (redefined || !back_mappers[i]) {
+            // first memory is enough to get common memory ptr
+            back_mappers[i] = std::make_shared<BackEdgePortHelper>(from_mem, to_mems.front(), eng);
+        }
     }
 }
 
@@ -60,38 +60,59 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The capacity of the buffer is doubled on growth, so the iterations take the amortized constant time, and the
+ * concatenated data is moved to the output once after the last iteration. The body output may be written right
+ * into its chunk of the buffer if the chunk is contiguous.
  */
 class DynamicBuffer {
 public:
     DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_);
     ~DynamicBuffer() = default;
 
+    /**
+     * Points the body output to the chunk of the next iteration if the output can be written in place
+     */
+    void prepare(const dnnl::engine& eng, const int iter);
     void execute(const dnnl::engine& eng, const int iter);
     void transfer(const Node* node);
 
+    const MemoryPtr& getSource() const {
+        return from;
+    }
+    void setInPlace(bool in_place_) {
+        in_place = in_place_;
+    }
+
 private:
-    void init(const dnnl::engine& eng);
+    void init();
+
+    /**
+     * Points the body output redirected to the buffer back to its own storage
+     */
+    void resetSource(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
-    void move_data();
+    void reserve(const dnnl::engine& eng, const size_t chunks);
+    uint8_t* get_chunk_ptr(const size_t chunk);
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(dnnl::memory& prim);
 
-    size_t len = 1lu;
     size_t count = 1lu;
+    size_t chunk_size = 0lu;   /**< bytes of the chunk of the iteration in each of count rows */
+    size_t capacity = 0lu;     /**< chunks the buffer may hold */
+    size_t num_chunks = 0lu;   /**< chunks written by the current execution */
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    bool in_place = false;
+    bool source_redirected = false;   /**< the body output refers the chunk of the buffer */
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
     PortMap map_rule;
 
     std::shared_ptr<dnnl::memory> mem_holder_buffer;
+    std::shared_ptr<dnnl::memory> mem_holder_source;
 };
 
 class TensorIterator : public Node {
@@ -122,6 +143,12 @@ private:
     void prepareOutputPorts();
     void prepareBackEdges();
     void prepareDynamicBackEdges();
+    /**
+     * The body memory may refer the buffers of the mappers instead of copying if the memory isn't a part of a
+     * bigger buffer and isn't redirected by another mapper yet
+     */
+    bool canRedirectBodyMemory(const MemoryPtr& mem);
+    bool canWriteChunkInPlace(const MemoryPtr& from, const MemoryPtr& to, const PortMap& map_rule);
     void prepareDynamicBuffers();
     void prepareLoopBodyCurrentIteration();
     void prepareContinueCond();
@@ -151,6 +178,7 @@ private:
         continue_cond_check;   /// < Perform check of continue condition value of body. value [0, 1]
 
     std::vector<std::shared_ptr<DynamicBuffer>> buffers;
+    std::vector<Memory*> redirected_mems;   /// < Body memories referring the buffers of the mappers
 
     std::vector<PortMap> inputPortMap;  //!< Input ports map
     std::vector<PortMap> outputPortMap;  //!< Output ports map
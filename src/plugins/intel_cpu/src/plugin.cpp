@@ -21,6 +21,7 @@
 #include <unordered_set>
 #include <ie_system_conf.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 
 #include <transformations/opset_conversions/convert_opset3_to_opset2.hpp>
 #include <transformations/opset_conversions/convert_opset2_to_opset1.hpp>
@@ -78,6 +79,7 @@
 #include <transformations/convert_precision.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/disable_decompression_convert_constant_folding.hpp>
+#include <transformations/keep_compressed_matmul_weights.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
@@ -171,6 +173,18 @@ Engine::Engine() :
     extensionManager->AddExtension(std::make_shared<Extension>());
 }
 
+MultiCachePtr Engine::getSharedRuntimeCache(size_t capacity) {
+    std::lock_guard<std::mutex> lock(sharedRtCacheMutex);
+    if (!sharedRtCache) {
+        sharedRtCache = std::make_shared<MultiCache>(capacity, true);
+    } else if (sharedRtCache->getCapacity() != capacity) {
+        IE_THROW() << "The runtime cache shared by the plugin is already created with the capacity "
+                   << sharedRtCache->getCapacity() << ", the capacity " << capacity << " can't be applied";
+    }
+    // the copy shares the records with the other networks but counts only the requests of the network
+    return std::make_shared<MultiCache>(*sharedRtCache);
+}
+
 Engine::~Engine() {
     executorManager()->clear("CPU");
     executorManager()->clear("CPUStreamsExecutor");
@@ -178,7 +192,8 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool isLegacyApi,
+                                               const bool _enableCompressedWeights) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -199,6 +214,13 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         }
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(defaultPrecisions);
     }
+    if (_enableCompressedWeights) {
+        // INT4 weights are unpacked to INT8 since FullyConnected reads whole bytes, the decompression is kept anyway
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array{{ngraph::element::i4, ngraph::element::i8},
+                                                                               {ngraph::element::u4, ngraph::element::u8}});
+        manager.register_pass<ov::pass::KeepCompressedMatMulWeights>(
+            ngraph::element::TypeVector{ngraph::element::f16, ngraph::element::i8, ngraph::element::u8});
+    }
     auto get_convert_precisions = []() {
         precisions_array array = {
             {ngraph::element::i64,     ngraph::element::i32},
@@ -250,6 +272,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     manager.register_pass<SwapConvertTranspose>();
 
     auto pass_config = manager.get_pass_config();
+    // the patterns of the large models are matched in parallel
+    pass_config->set_parallel_for([](size_t count, const std::function<void(size_t)>& body) {
+        InferenceEngine::parallel_for(count, body);
+    });
 
     using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
 
@@ -556,10 +582,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi,
+                           const bool _enableCompressedWeights) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi);
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi, _enableCompressedWeights);
+    ConvertToCPUSpecificOpset(nGraphFunc, _enableCompressedWeights);
 }
 
 static bool streamsSet(const std::map<std::string, std::string>& config) {
@@ -690,8 +717,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& compressedWeightsProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_COMPRESSED_WEIGHTS);
+    const bool enableCompressedWeights = (compressedWeightsProp != config.end() && compressedWeightsProp->second == PluginConfigParams::YES)
+            || engConfig.compressedWeights;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI());
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI(), enableCompressedWeights);
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -705,7 +735,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     ApplyPerformanceHints(config, nGraphFunc);
 
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    ConvertToCPUSpecificOpset(nGraphFunc, enableCompressedWeights);
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
@@ -931,7 +961,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16
                 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)));
-        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI());
+        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI(), conf.compressedWeights);
         auto ops = clonnedFunction->get_ordered_ops();
 
         //Mark removed nodes as supported
@@ -1027,6 +1057,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
+    PackedWeightsDeserializer::PackedWeights packedWeights;
+    PackedWeightsDeserializer weightsDeserializer(networkModel, dnnl::engine(dnnl::engine::kind::cpu, 0));
+    weightsDeserializer >> packedWeights;
+
     Config conf = engConfig;
     conf.readProperties(config);
 
@@ -1034,7 +1068,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), packedWeights);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -41,6 +41,13 @@ public:
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
                                                      const std::map<std::string, std::string>& config) override;
 
+    /**
+     * @brief Returns the thread safe runtime parameters cache shared by all the networks loaded to the plugin, the
+     * returned instance has its own statistics counters
+     * @param capacity of the cache, must be the same for all the networks sharing the cache
+     */
+    MultiCachePtr getSharedRuntimeCache(size_t capacity);
+
 private:
     bool isLegacyAPI() const;
 
@@ -56,6 +63,9 @@ private:
        So track if streams is set explicitly (not auto-configured) */
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
+
+    std::mutex sharedRtCacheMutex;
+    MultiCachePtr sharedRtCache;
 };
 
 }   // namespace intel_cpu
@@ -2,11 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "serialize.h"
+#include "graph.h"
+#include "dnnl_extension_utils.h"
 
+#include <openvino/core/version.hpp>
 #include <openvino/pass/serialize.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <mmap_object.hpp>
 
 #include <pugixml.hpp>
 
+#include <algorithm>
+#include <limits>
+
 using namespace InferenceEngine;
 
 namespace ov {
@@ -65,6 +73,112 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // the blob over the mapped stream data, the mapping lives while the blob is alive
+    class MappedAllocator : public IAllocator {
+    public:
+        MappedAllocator(std::shared_ptr<ngraph::runtime::AlignedBuffer> mapping, size_t offset)
+            : _mapping(std::move(mapping)), _offset(offset) {}
+
+        void* lock(void* handle, LockOp) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}  // NOLINT
+
+        void* alloc(size_t size) noexcept override {
+            return _offset + size <= _mapping->size() ? _mapping->get_ptr<char>() + _offset : nullptr;
+        }
+
+        bool free(void*) noexcept override {  // NOLINT
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ngraph::runtime::AlignedBuffer> _mapping;
+        size_t _offset;
+    };
+
+    constexpr uint32_t packedWeightsMagic = 0x5750564f;  // "OVPW"
+    constexpr uint32_t packedWeightsVersion = 3;
+    // the data offsets in the stream are aligned, so the data of the mapped stream may be used in place
+    constexpr uint64_t packedWeightsAlignment = 64;
+
+    // the packed weights depend on the plugin build and the ISA used to select the primitives
+    std::string packedWeightsTarget() {
+        return std::string(ov::get_openvino_version().buildNumber) + "_isa" +
+               std::to_string(static_cast<uint64_t>(dnnl::impl::cpu::x64::get_max_cpu_isa()));
+    }
+
+    void writeString(std::ostream & stream, const std::string & str) {
+        const uint64_t size = str.size();
+        stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        stream.write(str.data(), str.size());
+    }
+
+    // the size of the string is checked against the bytes left in the section before the allocation
+    bool readString(std::istream & stream, std::string & str, uint64_t sectionEnd) {
+        uint64_t size = 0;
+        if (!stream.read(reinterpret_cast<char*>(&size), sizeof(size)))
+            return false;
+        const auto pos = static_cast<int64_t>(stream.tellg());
+        if (pos < 0 || static_cast<uint64_t>(pos) > sectionEnd || size > sectionEnd - static_cast<uint64_t>(pos))
+            return false;
+        str.resize(size);
+        return static_cast<bool>(stream.read(&str[0], size));
+    }
+
+    // the descriptor is read from the blob as is, so it is checked before oneDNN uses it to compute the offsets
+    bool isValidPackedWeightsDesc(const dnnl_memory_desc_t & desc, uint64_t dataSize) {
+        if (desc.ndims <= 0 || desc.ndims > DNNL_MAX_NDIMS || desc.offset0 < 0)
+            return false;
+
+        switch (desc.data_type) {
+        case dnnl_f32:
+        case dnnl_bf16:
+        case dnnl_f16:
+        case dnnl_s32:
+        case dnnl_s8:
+        case dnnl_u8:
+        case dnnl_bin:
+            break;
+        default:
+            return false;
+        }
+
+        for (int d = 0; d < desc.ndims; d++) {
+            if (desc.dims[d] <= 0 || desc.padded_dims[d] < desc.dims[d] || desc.padded_offsets[d] < 0 ||
+                desc.padded_offsets[d] > desc.padded_dims[d] - desc.dims[d])
+                return false;
+        }
+
+        switch (desc.format_kind) {
+        case dnnl_blocked: {
+            const auto & blocking = desc.format_desc.blocking;
+            if (blocking.inner_nblks < 0 || blocking.inner_nblks > DNNL_MAX_NDIMS)
+                return false;
+            for (int b = 0; b < blocking.inner_nblks; b++) {
+                if (blocking.inner_blks[b] <= 0 || blocking.inner_idxs[b] < 0 || blocking.inner_idxs[b] >= desc.ndims)
+                    return false;
+            }
+            // the padded tensor fits the data, so the size computed by oneDNN doesn't overflow
+            uint64_t elements = 1;
+            for (int d = 0; d < desc.ndims; d++) {
+                if (blocking.strides[d] < 0 || static_cast<uint64_t>(desc.padded_dims[d]) > dataSize / elements)
+                    return false;
+                elements *= desc.padded_dims[d];
+            }
+            break;
+        }
+        case dnnl_format_kind_wino:
+        case dnnl_format_kind_rnn_packed:
+            break;
+        default:
+            return false;
+        }
+
+        return dnnl_memory_desc_get_size(&desc) == dataSize;
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -125,6 +239,141 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
+PackedWeightsSerializer::PackedWeightsSerializer(std::ostream & ostream)
+    : _ostream(ostream) {
+}
+
+void PackedWeightsSerializer::operator << (const Graph & graph) {
+    const auto weights = graph.getPackedWeights();
+    const auto target = packedWeightsTarget();
+
+    // The section size is written before the section, so the reader may skip the section of another target, e.g. when
+    // HETERO concatenates the exported subnetworks into one stream. The paddings are computed in advance for that.
+    const auto start = static_cast<int64_t>(_ostream.tellp());
+    uint64_t pos = static_cast<uint64_t>(std::max<int64_t>(start, 0)) +
+                   sizeof(packedWeightsMagic) + sizeof(packedWeightsVersion) + sizeof(uint64_t);
+    const uint64_t sectionBegin = pos;
+    pos += sizeof(uint64_t) + target.size() + sizeof(uint64_t);
+    std::vector<uint64_t> paddings;
+    for (const auto & weight : weights) {
+        pos += sizeof(uint64_t) + weight.first.size() + sizeof(dnnl_memory_desc_t) + 2 * sizeof(uint64_t);
+        const uint64_t padding = start < 0 ? 0 :
+                                 (packedWeightsAlignment - pos % packedWeightsAlignment) % packedWeightsAlignment;
+        paddings.push_back(padding);
+        pos += padding + weight.second->GetSize();
+    }
+    const uint64_t sectionSize = pos - sectionBegin;
+
+    _ostream.write(reinterpret_cast<const char*>(&packedWeightsMagic), sizeof(packedWeightsMagic));
+    _ostream.write(reinterpret_cast<const char*>(&packedWeightsVersion), sizeof(packedWeightsVersion));
+    _ostream.write(reinterpret_cast<const char*>(&sectionSize), sizeof(sectionSize));
+    writeString(_ostream, target);
+
+    const uint64_t count = weights.size();
+    _ostream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (size_t i = 0; i < weights.size(); i++) {
+        const auto & weight = weights[i];
+        const auto & desc = weight.second->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc().data;
+        const uint64_t dataSize = weight.second->GetSize();
+
+        writeString(_ostream, weight.first);
+        _ostream.write(reinterpret_cast<const char*>(&desc), sizeof(desc));
+        _ostream.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+
+        const uint64_t padding = paddings[i];
+        const std::vector<char> zeros(padding, 0);
+        _ostream.write(reinterpret_cast<const char*>(&padding), sizeof(padding));
+        _ostream.write(zeros.data(), padding);
+
+        _ostream.write(static_cast<const char*>(weight.second->GetData()), dataSize);
+    }
+}
+
+PackedWeightsDeserializer::PackedWeightsDeserializer(std::istream & istream, const dnnl::engine & engine)
+    : _istream(istream)
+    , _engine(engine) {
+}
+
+void PackedWeightsDeserializer::operator >> (PackedWeights & weights) {
+    weights.clear();
+
+    const auto start = _istream.tellg();
+    // the network may be exported by a plugin which doesn't write the section, the stream is returned to the start then
+    auto rewind = [&]() {
+        _istream.clear();
+        _istream.seekg(start);
+    };
+
+    uint32_t magic = 0, version = 0;
+    uint64_t sectionSize = 0;
+    if (start == std::streampos(-1) ||
+        !_istream.read(reinterpret_cast<char*>(&magic), sizeof(magic)) || magic != packedWeightsMagic ||
+        !_istream.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != packedWeightsVersion ||
+        !_istream.read(reinterpret_cast<char*>(&sectionSize), sizeof(sectionSize))) {
+        rewind();
+        return;
+    }
+
+    const auto sectionBegin = static_cast<uint64_t>(_istream.tellg());
+    if (sectionSize > std::numeric_limits<uint64_t>::max() - sectionBegin)
+        IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+    const uint64_t sectionEnd = sectionBegin + sectionSize;
+    // the section of another build or CPU is skipped
+    auto skip = [&]() {
+        _istream.clear();
+        _istream.seekg(static_cast<std::streamoff>(sectionEnd));
+    };
+
+    std::string target;
+    uint64_t count = 0;
+    if (!readString(_istream, target, sectionEnd) || target != packedWeightsTarget() ||
+        !_istream.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+        skip();
+        return;
+    }
+
+    auto mapped = dynamic_cast<ov::MappedStreamBuffer*>(_istream.rdbuf());
+    for (uint64_t i = 0; i < count; i++) {
+        std::string key;
+        dnnl_memory_desc_t desc;
+        uint64_t dataSize = 0, padding = 0;
+        if (!readString(_istream, key, sectionEnd) ||
+            !_istream.read(reinterpret_cast<char*>(&desc), sizeof(desc)) ||
+            !_istream.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize)) ||
+            !_istream.read(reinterpret_cast<char*>(&padding), sizeof(padding)) ||
+            padding >= packedWeightsAlignment ||
+            !_istream.seekg(padding, std::ios_base::cur)) {
+            IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+        }
+        const auto pos = static_cast<uint64_t>(_istream.tellg());
+        if (pos > sectionEnd || dataSize > sectionEnd - pos || !isValidPackedWeightsDesc(desc, dataSize))
+            IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+
+        const auto memDesc = DnnlExtensionUtils::makeDescriptor(dnnl::memory::desc(desc));
+        const char* mappedData = nullptr;
+        if (mapped && pos + dataSize <= mapped->mapping()->size())
+            mappedData = mapped->mapping()->get_ptr<char>() + pos;
+
+        MemoryPtr memory;
+        if (mappedData && reinterpret_cast<uintptr_t>(mappedData) % packedWeightsAlignment == 0) {
+            // the memory refers the read-only mapped data, the mapping is kept by the memory
+            auto mapping = mapped->mapping();
+            memory = MemoryPtr(new Memory(_engine), [mapping](Memory* ptr) { delete ptr; });
+            memory->Create(memDesc, mappedData, false);
+            if (memory->GetSize() != dataSize || !_istream.seekg(dataSize, std::ios_base::cur))
+                IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+        } else {
+            memory = std::make_shared<Memory>(_engine);
+            memory->Create(memDesc);
+            if (memory->GetSize() != dataSize || !_istream.read(static_cast<char*>(memory->GetData()), dataSize))
+                IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+        }
+
+        weights[key] = memory;
+    }
+    skip();
+}
+
 CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
     : _istream(istream)
     , _cnn_network_builder(fn) {
@@ -152,10 +401,18 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc constsDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        auto mapped = dynamic_cast<ov::MappedStreamBuffer*>(_istream.rdbuf());
+        if (mapped && hdr.consts_offset + hdr.consts_size <= mapped->mapping()->size()) {
+            // the constants refer the mapped data, so the processes reading the same blob share the memory
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                constsDesc, std::make_shared<MappedAllocator>(mapped->mapping(), hdr.consts_offset));
+            dataBlob->allocate();
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
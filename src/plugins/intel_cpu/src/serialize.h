@@ -3,9 +3,11 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "cpu_memory.h"
 
 #include <iostream>
 #include <functional>
+#include <unordered_map>
 #include <cpp/ie_cnn_network.h>
 
 namespace ov {
@@ -35,7 +37,34 @@ private:
     cnn_network_builder _cnn_network_builder;
 };
 
-// const std::string& model, const Blob::CPtr& weights
+class Graph;
+
+/**
+ * The packed weights section of the exported network: the memory of the constant edges computed by the graph
+ * (weights reorders etc.) keyed by the weights cache keys. The imported network takes the weights as is
+ * instead of repacking them. The section follows the IR, so the plugins which don't know it just ignore it.
+ * The section is valid only for the same plugin build and CPU ISA, otherwise it is skipped on import.
+ */
+class PackedWeightsSerializer {
+public:
+    explicit PackedWeightsSerializer(std::ostream & ostream);
+    void operator << (const Graph & graph);
+
+private:
+    std::ostream & _ostream;
+};
+
+class PackedWeightsDeserializer {
+public:
+    using PackedWeights = std::unordered_map<std::string, MemoryPtr>;
+
+    PackedWeightsDeserializer(std::istream & istream, const dnnl::engine & engine);
+    void operator >> (PackedWeights & weights);
+
+private:
+    std::istream & _istream;
+    dnnl::engine _engine;
+};
 
 }   // namespace intel_cpu
 }   // namespace ov
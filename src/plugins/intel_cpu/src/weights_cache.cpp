@@ -3,13 +3,38 @@
 //
 
 #include "weights_cache.hpp"
+#include "nodes/common/cpu_memcpy.h"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <openvino/util/xxhash.hpp>
+#include <algorithm>
+#include <cstring>
+#include <future>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+uint64_t SimpleDataHash::hashSerial(const unsigned char* data, size_t size, uint64_t seed) {
+    return ov::util::xxhash64(data, size, seed);
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= chunkSize)
+        return hashSerial(data, size);
+
+    const size_t chunksNum = (size + chunkSize - 1) / chunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * chunkSize;
+        chunkHashes[i] = hashSerial(data + offset, std::min(chunkSize, size - offset));
+    });
+    return hashSerial(reinterpret_cast<const unsigned char*>(chunkHashes.data()), chunksNum * sizeof(uint64_t), size);
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -45,14 +70,125 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
 
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
-            newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+            if ((newPtr = copyPreloaded(key))) {
+                ptr = std::make_shared<MemoryInfo>(newPtr, true);
+            } else {
+                newPtr = create();
+                ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+            }
             sharedWeights[key] = ptr;
         }
     }
-    return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    return makeSharedMemory(ptr, newPtr);
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
+                            const std::string& key,
+                            std::function<std::string(void)> contentKey,
+                            std::function<MemoryPtr(void)> create,
+                            bool valid,
+                            std::function<bool(const Memory&)> sameContent) {
+    // Process-wide cache, the entries are owned by the caches of the networks. The memory is created without the lock,
+    // the concurrent requests of the same content wait for the creation in flight.
+    static std::mutex contentGuard;
+    static std::unordered_map<std::string, std::weak_ptr<MemoryInfo>> contentCache;
+    static std::unordered_map<std::string, std::shared_future<MemoryInfo::Ptr>> contentInFlight;
+    static size_t cleanupThreshold = 64;
+
+    auto createUnshared = [&]() -> std::pair<MemoryInfo::Ptr, MemoryPtr> {
+        MemoryPtr memory = create();
+        return {std::make_shared<MemoryInfo>(memory, valid), memory};
+    };
+
+    // the hash of the content may collide, so the shared memory is checked if the caller can compare the content
+    auto isSame = [&](const MemoryInfo::Ptr& info, const MemoryPtr& memory) {
+        if (!sameContent)
+            return true;
+        // the memory is compared after it is filled by the first user
+        std::unique_lock<std::mutex> memoryLock(info->guard, std::defer_lock);
+        if (!info->valid.load(std::memory_order_acquire))
+            memoryLock.lock();
+        return sameContent(*memory);
+    };
+
+    auto findOrCreateContent = [&](const std::string& content) -> std::pair<MemoryInfo::Ptr, MemoryPtr> {
+        std::unique_lock<std::mutex> contentLock(contentGuard);
+        while (true) {
+            auto found = contentCache.find(content);
+            MemoryInfo::Ptr info;
+            MemoryPtr memory;
+            if (found != contentCache.end() && (info = found->second.lock()) && (memory = info->sharedMemory.lock())) {
+                contentLock.unlock();
+                return isSame(info, memory) ? std::make_pair(info, memory) : createUnshared();
+            }
+
+            auto inFlight = contentInFlight.find(content);
+            if (inFlight != contentInFlight.end()) {
+                auto future = inFlight->second;
+                contentLock.unlock();
+                try {
+                    info = future.get();
+                } catch (...) {
+                    info = nullptr;
+                }
+                contentLock.lock();
+                if (info && (memory = info->sharedMemory.lock())) {
+                    contentLock.unlock();
+                    return isSame(info, memory) ? std::make_pair(info, memory) : createUnshared();
+                }
+                // the creation has failed or the memory is already released, try again
+                continue;
+            }
+
+            std::promise<MemoryInfo::Ptr> promise;
+            contentInFlight[content] = promise.get_future().share();
+            contentLock.unlock();
+            try {
+                memory = create();
+            } catch (...) {
+                contentLock.lock();
+                contentInFlight.erase(content);
+                promise.set_exception(std::current_exception());
+                throw;
+            }
+            info = std::make_shared<MemoryInfo>(memory, valid);
+
+            contentLock.lock();
+            contentInFlight.erase(content);
+            contentCache[content] = info;
+            if (contentCache.size() >= cleanupThreshold) {
+                for (auto it = contentCache.begin(); it != contentCache.end();)
+                    it = it->second.expired() ? contentCache.erase(it) : std::next(it);
+                cleanupThreshold = std::max<size_t>(64, contentCache.size() * 2);
+            }
+            promise.set_value(info);
+            return {info, memory};
+        }
+    };
+
+    MemoryInfo::Ptr ptr;
+    MemoryPtr newPtr;
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        auto found = sharedWeights.find(key);
+        if (found == sharedWeights.end()
+            || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
+            // the content key is computed under the lock, so the streams of the network don't hash the same data concurrently
+            if ((newPtr = copyPreloaded(key))) {
+                ptr = std::make_shared<MemoryInfo>(newPtr, true);
+                sharedWeights[key] = ptr;
+                return makeSharedMemory(ptr, newPtr);
+            }
+            const auto content = contentKey();
+            if (content.empty()) {
+                std::tie(ptr, newPtr) = createUnshared();
+            } else {
+                std::tie(ptr, newPtr) = findOrCreateContent(std::to_string(numaNodeId) + "_" + content);
+            }
+            sharedWeights[key] = ptr;
+        }
+    }
+    return makeSharedMemory(ptr, newPtr);
 }
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
@@ -66,6 +202,35 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock())))
             IE_THROW() << "Unknown shared memory with key " << key;
     }
+    return makeSharedMemory(ptr, newPtr);
+}
+
+void WeightsSharing::preload(const std::string& key, MemoryPtr memory, bool copy) {
+    std::unique_lock<std::mutex> lock(guard);
+    if (copy) {
+        preloadedSources[key] = memory;
+    } else {
+        sharedWeights[key] = std::make_shared<MemoryInfo>(memory, true);
+    }
+}
+
+MemoryPtr WeightsSharing::copyPreloaded(const std::string& key) {
+    auto found = preloadedSources.find(key);
+    if (found == preloadedSources.end())
+        return nullptr;
+    auto source = found->second.lock();
+    preloadedSources.erase(found);
+    if (!source)
+        return nullptr;
+
+    // the copy is filled by the caller's thread, so the pages are placed on its NUMA node
+    auto memory = std::make_shared<Memory>(source->getEngine());
+    memory->Create(source->getDescPtr());
+    cpu_memcpy(memory->GetData(), source->GetData(), source->GetSize());
+    return memory;
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::makeSharedMemory(const MemoryInfo::Ptr& ptr, MemoryPtr newPtr) const {
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                                 ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
@@ -73,7 +238,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
 
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<WeightsSharing>(numa_id);
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
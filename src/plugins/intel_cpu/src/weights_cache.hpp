@@ -23,28 +23,19 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * 64-bit non-cryptographic hash of the data (ov::util::xxhash64).
+ * Large buffers are split into fixed size chunks which are hashed in parallel and the chunk hashes are hashed again.
+ * The result does not depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static uint64_t hashSerial(const unsigned char* data, size_t size, uint64_t seed = 0);
+
+private:
+    static constexpr size_t chunkSize = 1 << 20;
 };
 
 /**
@@ -54,6 +45,10 @@ protected:
  * Is a thread safe
  */
 class WeightsSharing {
+public:
+    explicit WeightsSharing(int numaNodeId = -1) : numaNodeId(numaNodeId) {}
+
+private:
     struct MemoryInfo {
         typedef std::shared_ptr<MemoryInfo> Ptr;
 
@@ -92,13 +87,45 @@ public:
                                    std::function<MemoryPtr(void)> create,
                                    bool valid = true);
 
+    /**
+     * Same as findOrCreate, but if the key is not found, the memory is looked up by the content key
+     * in the process-wide cache of the NUMA node. So the identical weights are stored once even if they are used
+     * by several networks, the memory is released when the last network using it is destroyed.
+     *
+     * @param contentKey describes the memory content (data hash, precision, layout), is called only if the key is not found.
+     *        Empty content key means that the memory can't be shared with other networks.
+     * @param sameContent compares the memory found by the content key with the content of the caller, the memory is not
+     *        shared if the content differs (hash collision). The memory is not compared if the function is empty.
+     * @note The memory is created without holding the process-wide lock, the concurrent requests of the same content
+     *       wait for the memory in flight.
+     */
+    SharedMemory::Ptr findOrCreate(const std::string& key,
+                                   std::function<std::string(void)> contentKey,
+                                   std::function<MemoryPtr(void)> create,
+                                   bool valid = true,
+                                   std::function<bool(const Memory&)> sameContent = nullptr);
+
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Adds the valid memory computed outside of the network (e.g. the repacked weights of the imported network)
+     * @param copy if true, the memory is copied on the first request of the key, so the copy is allocated and
+     *        touched by the stream of the NUMA node of the cache. Otherwise the memory is used in place.
+     * @note The cache doesn't own the memory, the caller must hold it until the graphs are created
+     */
+    void preload(const std::string& key, MemoryPtr memory, bool copy = false);
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    SharedMemory::Ptr makeSharedMemory(const MemoryInfo::Ptr& ptr, MemoryPtr newPtr) const;
+    // must be called under the guard
+    MemoryPtr copyPreloaded(const std::string& key);
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::unordered_map<std::string, std::weak_ptr<Memory>> preloadedSources;
+    int numaNodeId;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include "common_test_utils/graph_comparator.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+// The synthetic model with the chains of the blocks having the own weights:
+//  Param -> [Add(Constant) -> Relu -> Multiply(Constant)] x blocks -> Result, a chain per Result
+std::shared_ptr<ov::Model> make_model(size_t chains, size_t blocks) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    param->set_friendly_name("param");
+    ov::ResultVector results;
+    for (size_t chain = 0; chain < chains; chain++) {
+        ov::Output<ov::Node> last = param;
+        for (size_t block = 0; block < blocks; block++) {
+            const auto id = std::to_string(chain) + "_" + std::to_string(block);
+            auto bias = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 16}, {0.5f * block});
+            bias->set_friendly_name("bias_" + id);
+            auto add = std::make_shared<ov::opset8::Add>(last, bias);
+            add->set_friendly_name("add_" + id);
+            auto relu = std::make_shared<ov::opset8::Relu>(add);
+            relu->set_friendly_name("relu_" + id);
+            auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1}, {1.f + chain});
+            scale->set_friendly_name("scale_" + id);
+            last = std::make_shared<ov::opset8::Multiply>(relu, scale);
+            last.get_node()->set_friendly_name("multiply_" + id);
+        }
+        results.push_back(std::make_shared<ov::opset8::Result>(last));
+    }
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{param});
+}
+
+std::pair<std::string, ov::Tensor> serialize(const std::shared_ptr<ov::Model>& model) {
+    std::stringstream xml, bin;
+    ov::pass::Serialize(xml, bin).run_on_model(model);
+    const auto bin_str = bin.str();
+    ov::Tensor weights(ov::element::u8, ov::Shape{bin_str.size()});
+    std::memcpy(weights.data(), bin_str.data(), bin_str.size());
+    return {xml.str(), weights};
+}
+}  // namespace
+
+TEST(LargeModelDeserializationTest, ModelIsRestored) {
+    // the model is large enough to parse the layers and create the constants in parallel
+    auto model = make_model(4, 200);
+    const auto ir = serialize(model);
+
+    ov::Core core;
+    auto read_model = core.read_model(ir.first, ir.second);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(read_model, model);
+    ASSERT_TRUE(res.valid) << res.message;
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,7 @@
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <threading/ie_thread_safe_containers.hpp>
 #include <ie_system_conf.h>
 #include <thread>
 
@@ -238,5 +240,49 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+TEST(ThreadSafeBoundedLockFreeQueueTests, canPushAndPopFromMultipleThreads) {
+    ThreadSafeBoundedLockFreeQueue<Task> queue{64};
+    constexpr int THREAD_NUMBER = 4;
+    constexpr int NUM_TASKS = 10000;
+    std::atomic_int sharedVar = {0};
+    std::atomic_int numPopped = {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_NUMBER; i++) {
+        threads.emplace_back([&] {
+            for (int k = 0; k < NUM_TASKS; k++) {
+                Task task = [&] { ++sharedVar; };
+                while (!queue.try_push(std::move(task)))
+                    std::this_thread::yield();
+            }
+        });
+        threads.emplace_back([&] {
+            Task task;
+            while (numPopped < THREAD_NUMBER * NUM_TASKS) {
+                if (queue.try_pop(task)) {
+                    task();
+                    ++numPopped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) thread.join();
+    ASSERT_EQ(THREAD_NUMBER * NUM_TASKS, sharedVar);
+    Task task;
+    ASSERT_FALSE(queue.try_pop(task));
+}
 
-
+TEST(ThreadSafeBoundedLockFreeQueueTests, fullQueueKeepsValue) {
+    ThreadSafeBoundedLockFreeQueue<std::shared_ptr<int>> queue{2};
+    ASSERT_TRUE(queue.try_push(std::make_shared<int>(0)));
+    ASSERT_TRUE(queue.try_push(std::make_shared<int>(1)));
+    auto value = std::make_shared<int>(2);
+    ASSERT_FALSE(queue.try_push(std::move(value)));
+    ASSERT_NE(nullptr, value);
+    std::shared_ptr<int> popped;
+    ASSERT_TRUE(queue.try_pop(popped));
+    ASSERT_EQ(0, *popped);
+    // the queue doesn't own the popped value
+    ASSERT_EQ(1, popped.use_count());
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "openvino/core/model.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/convert_precision.hpp"
+#include "transformations/init_node_info.hpp"
+#include "transformations/keep_compressed_matmul_weights.hpp"
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+void run_passes(const std::shared_ptr<ov::Model>& f) {
+    ov::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ov::pass::KeepCompressedMatMulWeights>();
+    manager.register_pass<ov::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array{{ov::element::f16, ov::element::f32}});
+    manager.run_passes(f);
+}
+}  // namespace
+
+TEST(TransformationTests, KeepCompressedMatMulWeightsFP16) {
+    auto make_model = []() {
+        auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 4});
+        auto weights = ov::opset8::Constant::create(ov::element::f16, ov::Shape{3, 4}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto matmul = std::make_shared<ov::opset8::MatMul>(input, convert, false, true);
+        return std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{input});
+    };
+
+    auto f = make_model();
+    run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto res = compare_functions(f, make_model(), true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, KeepCompressedMatMulWeightsU8WithZeroPointAndScale) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 4});
+        auto weights = ov::opset8::Constant::create(ov::element::u8, ov::Shape{3, 4}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto zero_point = ov::opset8::Constant::create(ov::element::u8, ov::Shape{3, 1}, {1, 2, 3});
+        auto zero_point_convert = std::make_shared<ov::opset8::Convert>(zero_point, ov::element::f32);
+        auto subtract = std::make_shared<ov::opset8::Subtract>(convert, zero_point_convert);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{3, 1}, {0.5f, 0.25f, 0.125f});
+        auto multiply = std::make_shared<ov::opset8::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<ov::opset8::MatMul>(input, multiply, false, true);
+        f = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{input});
+
+        run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 4});
+        auto weights = ov::opset8::Constant::create(ov::element::u8, ov::Shape{3, 4}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto zero_point = ov::opset8::Constant::create(ov::element::f32, ov::Shape{3, 1}, {1, 2, 3});
+        auto subtract = std::make_shared<ov::opset8::Subtract>(convert, zero_point);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{3, 1}, {0.5f, 0.25f, 0.125f});
+        auto multiply = std::make_shared<ov::opset8::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<ov::opset8::MatMul>(input, multiply, false, true);
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, KeepCompressedMatMulWeightsSharedWeightsAreFolded) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 4});
+        auto weights = ov::opset8::Constant::create(ov::element::f16, ov::Shape{4, 4}, {1});
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto matmul = std::make_shared<ov::opset8::MatMul>(input, convert);
+        auto add = std::make_shared<ov::opset8::Add>(matmul, convert);
+        f = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{input});
+
+        run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto input = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 4});
+        auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{4, 4}, {1});
+        auto matmul = std::make_shared<ov::opset8::MatMul>(input, weights);
+        auto add = std::make_shared<ov::opset8::Add>(matmul, weights);
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "hetero_cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include "ie_system_conf.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+using namespace ngraph;
+
+namespace HeteroTests {
+
+/* The model is split by HETERO into one pipeline stage per NUMA node by the profiled latencies of the layers, the
+   streams of each stage are bound to its NUMA node. The results must match the model compiled on CPU.
+
+    Param -> [MatMul -> Relu] x layers -> Result
+*/
+class HeteroCpuNumaPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        model = makeMatMulReluChain(batch, hiddenSize, layers);
+
+        core = ov::test::utils::PluginCache::get().core();
+        const auto heteroDevice = std::string(CommonTestUtils::DEVICE_HETERO) + ":" + CommonTestUtils::DEVICE_CPU;
+        const ov::AnyMap config{{HETERO_CONFIG_KEY(NUMA_PIPELINE), InferenceEngine::PluginConfigParams::YES}};
+        compiledModel = core->compile_model(model, heteroDevice, config);
+    }
+
+    ov::Tensor makeInput(size_t index) {
+        return makeMatMulReluChainInput(batch, hiddenSize, index);
+    }
+
+    static constexpr size_t batch = 8;
+    static constexpr size_t hiddenSize = 256;
+    static constexpr size_t layers = 16;
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<ov::Core> core;
+    ov::CompiledModel compiledModel;
+};
+
+constexpr size_t HeteroCpuNumaPipelineTest::batch;
+constexpr size_t HeteroCpuNumaPipelineTest::hiddenSize;
+constexpr size_t HeteroCpuNumaPipelineTest::layers;
+
+TEST_F(HeteroCpuNumaPipelineTest, smoke_StagesPerNumaNode) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ASSERT_TRUE(compiledModel.get_property(HETERO_CONFIG_KEY(NUMA_PIPELINE)).as<bool>());
+
+    // the model is split only on the machines with several NUMA nodes
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    if (numaNodes.size() > 1) {
+        std::stringstream exported;
+        compiledModel.export_model(exported);
+        std::string header;
+        std::getline(exported, header);
+        size_t stages = 0;
+        for (auto&& numaNode : numaNodes) {
+            const auto device = std::string(CommonTestUtils::DEVICE_CPU) + "." + std::to_string(numaNode);
+            if (header.find("device=\"" + device + "\"") != std::string::npos)
+                stages++;
+        }
+        ASSERT_GE(stages, 2u);
+    }
+
+    auto reference = core->compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+    const auto requestsNumber = compiledModel.get_property(ov::optimal_number_of_infer_requests);
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < requestsNumber; i++)
+        requests.push_back(compiledModel.create_infer_request());
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].set_tensor("input", makeInput(i));
+        requests[i].start_async();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].wait();
+        reference.set_tensor("input", makeInput(i));
+        reference.infer();
+        const auto expected = reference.get_tensor("output");
+        const auto actual = requests[i].get_tensor("output");
+        ASSERT_EQ(actual.get_shape(), expected.get_shape());
+        for (size_t j = 0; j < actual.get_size(); j++)
+            ASSERT_NEAR(actual.data<const float>()[j], expected.data<const float>()[j],
+                        1e-4f * std::max(1.f, std::abs(expected.data<const float>()[j])))
+                << "request: " << i << " index: " << j;
+    }
+}
+
+TEST_F(HeteroCpuNumaPipelineTest, smoke_StreamsAreBoundToExistingNumaNode) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    const auto missingNode = *std::max_element(numaNodes.begin(), numaNodes.end()) + 1;
+    ASSERT_NO_THROW(core->compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                        {{CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID), std::to_string(numaNodes.front())}}));
+    ASSERT_ANY_THROW(core->compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                         {{CONFIG_KEY_INTERNAL(CPU_NUMA_NODE_ID), std::to_string(missingNode)}}));
+}
+
+} // namespace HeteroTests
@@ -0,0 +1,101 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "hetero_cpu_test_utils.hpp"
+
+#include <sstream>
+#include <unordered_set>
+
+using namespace ngraph;
+
+namespace HeteroTests {
+
+/* The model is split by the affinities into two stages loaded on CPU, the stages of the consecutive requests run in
+   parallel. The results of the requests in flight must match the model compiled on CPU.
+
+    Param -> [MatMul -> Relu] x layers / 2 (CPU.0) -> [MatMul -> Relu] x layers / 2 (CPU.1) -> Result
+*/
+class HeteroCpuPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        model = makeMatMulReluChain(1, hiddenSize, layers);
+        // the parameter and the first half of the layers, each layer is MatMul with the weights followed by Relu
+        std::unordered_set<Node*> firstStage;
+        Node* last = model->get_parameters().front().get();
+        firstStage.insert(last);
+        for (size_t layer = 0; layer < layers / 2; layer++) {
+            auto matMul = last->output(0).get_target_inputs().begin()->get_node();
+            last = matMul->output(0).get_target_inputs().begin()->get_node();
+            firstStage.insert({matMul->get_input_node_ptr(1), matMul, last});
+        }
+        for (auto&& node : model->get_ordered_ops())
+            node->get_rt_info()["affinity"] = std::string(firstStage.count(node.get()) ? stages[0] : stages[1]);
+
+        core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, heteroDevice());
+    }
+
+    static std::string heteroDevice() {
+        return std::string(CommonTestUtils::DEVICE_HETERO) + ":" + stages[0] + "," + stages[1];
+    }
+
+    ov::Tensor makeInput(size_t index) {
+        return makeMatMulReluChainInput(1, hiddenSize, index);
+    }
+
+    static constexpr size_t hiddenSize = 64;
+    static constexpr size_t layers = 8;
+    static const char* const stages[2];
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<ov::Core> core;
+    ov::CompiledModel compiledModel;
+};
+
+constexpr size_t HeteroCpuPipelineTest::hiddenSize;
+constexpr size_t HeteroCpuPipelineTest::layers;
+const char* const HeteroCpuPipelineTest::stages[2] = {"CPU.0", "CPU.1"};
+
+TEST_F(HeteroCpuPipelineTest, smoke_StagesOfRequestsInFlight) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // each stage is a separate subnetwork
+    std::stringstream exported;
+    compiledModel.export_model(exported);
+    std::string header;
+    std::getline(exported, header);
+    ASSERT_NE(header.find(std::string("device=\"") + stages[0] + "\""), std::string::npos);
+    ASSERT_NE(header.find(std::string("device=\"") + stages[1] + "\""), std::string::npos);
+
+    // each stage needs its own requests in flight
+    const auto requestsNumber = compiledModel.get_property(ov::optimal_number_of_infer_requests);
+    ASSERT_GE(requestsNumber, 2u);
+
+    auto reference = core->compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < requestsNumber; i++)
+        requests.push_back(compiledModel.create_infer_request());
+    for (size_t round = 0; round < 3; round++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].set_tensor("input", makeInput(round * requests.size() + i));
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            reference.set_tensor("input", makeInput(round * requests.size() + i));
+            reference.infer();
+            const auto expected = reference.get_tensor("output");
+            const auto actual = requests[i].get_tensor("output");
+            ASSERT_EQ(actual.get_shape(), expected.get_shape());
+            for (size_t j = 0; j < actual.get_size(); j++)
+                ASSERT_NEAR(actual.data<const float>()[j], expected.data<const float>()[j], 1e-4f)
+                    << "request: " << i << " index: " << j;
+        }
+    }
+}
+
+} // namespace HeteroTests
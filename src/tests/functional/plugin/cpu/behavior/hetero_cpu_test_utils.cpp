@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_cpu_test_utils.hpp"
+
+#include <ngraph/opsets/opset8.hpp>
+
+#include <vector>
+
+using namespace ngraph;
+
+namespace HeteroTests {
+
+std::shared_ptr<ov::Model> makeMatMulReluChain(size_t batch, size_t hiddenSize, size_t layers) {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{batch, hiddenSize});
+    param->get_output_tensor(0).set_names({"input"});
+    std::shared_ptr<Node> last = param;
+    for (size_t layer = 0; layer < layers; layer++) {
+        std::vector<float> weightsValues(hiddenSize * hiddenSize);
+        for (size_t i = 0; i < weightsValues.size(); i++)
+            weightsValues[i] = static_cast<float>((i + layer) % 5) / (5.f * hiddenSize);
+        auto weights = opset8::Constant::create(element::f32, Shape{hiddenSize, hiddenSize}, weightsValues);
+        last = std::make_shared<opset8::Relu>(std::make_shared<opset8::MatMul>(last, weights));
+    }
+    last->get_output_tensor(0).set_names({"output"});
+    return std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(last)}, ParameterVector{param});
+}
+
+ov::Tensor makeMatMulReluChainInput(size_t batch, size_t hiddenSize, size_t index) {
+    ov::Tensor input(element::f32, Shape{batch, hiddenSize});
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<float>((i + index) % 11) - 5.f;
+    return input;
+}
+
+} // namespace HeteroTests
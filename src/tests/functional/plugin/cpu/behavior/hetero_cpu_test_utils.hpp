@@ -0,0 +1,23 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+#include <memory>
+
+namespace HeteroTests {
+
+/* The chain of the layers the HETERO pipeline tests split into the stages, the weights differ per layer.
+
+    Param[batch, hiddenSize] "input" -> [MatMul -> Relu] x layers -> Result "output"
+*/
+std::shared_ptr<ov::Model> makeMatMulReluChain(size_t batch, size_t hiddenSize, size_t layers);
+
+// the input of the chain, the values differ per index
+ov::Tensor makeMatMulReluChainInput(size_t batch, size_t hiddenSize, size_t index);
+
+} // namespace HeteroTests
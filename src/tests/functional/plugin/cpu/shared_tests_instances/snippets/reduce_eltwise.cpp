@@ -0,0 +1,58 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/reduce_eltwise.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+namespace {
+
+// the row lengths cover the vector tile only, the scalar tile only and both of them
+const std::vector<ov::Shape> inputShapes = {
+        {1, 4, 16, 64},
+        {1, 4, 16, 7},
+        {2, 3, 37},
+        {5, 1001},
+};
+
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, SoftmaxReduceEltwise,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(2), // Sinh + Subgraph
+                                 ::testing::Values(1), // reductions and eltwises are fused into a single Subgraph
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             SoftmaxReduceEltwise::getTestCaseName);
+
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, LayerNormReduceEltwise,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(2), // Sinh + Subgraph
+                                 ::testing::Values(1), // reductions and eltwises are fused into a single Subgraph
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             LayerNormReduceEltwise::getTestCaseName);
+
+    // the maximum is subtracted from every element of the row, so every lane of the maximum must include the tail
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, MaxSubtractReduceEltwise,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(2), // Sinh + Subgraph
+                                 ::testing::Values(1), // reductions and eltwises are fused into a single Subgraph
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             MaxSubtractReduceEltwise::getTestCaseName);
+
+    // the reduction is the output of the snippet, every row gets exactly one value
+    INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, ExpMeanReduceEltwise,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(2), // Sinh + Subgraph
+                                 ::testing::Values(1), // the reduction and the eltwise are fused into a single Subgraph
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                             ExpMeanReduceEltwise::getTestCaseName);
+
+}  // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
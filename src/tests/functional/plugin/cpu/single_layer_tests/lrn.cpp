@@ -20,7 +20,8 @@ using LRNParams = std::tuple<
     double,                // beta
     double,                // bias
     size_t,                // size
-    std::vector<int64_t>>; // axes to reduction
+    std::vector<int64_t>,  // axes to reduction
+    CPUSpecificParams>;
 
 class LRNLayerCPUTest : public testing::WithParamInterface<LRNParams>, public ov::test::SubgraphBaseTest, public CPUTestsBase {
 public:
@@ -30,7 +31,8 @@ public:
         double alpha, beta, bias;
         size_t size;
         std::vector<int64_t> axes;
-        std::tie(inputPrecision, inputShapes, alpha, beta, bias, size, axes) = obj.param;
+        CPUSpecificParams cpuParams;
+        std::tie(inputPrecision, inputShapes, alpha, beta, bias, size, axes, cpuParams) = obj.param;
 
         std::ostringstream result;
         result << inputPrecision << "_" << "IS=" << CommonTestUtils::partialShape2str({ inputShapes.first }) << "_" << "TS=(";
@@ -39,6 +41,7 @@ public:
         }
 
         result << ")_alpha=" << alpha << "_beta=" << beta << "_bias=" << bias << "_size=" << size << "_axes=" << CommonTestUtils::vec2str(axes);
+        result << CPUTestsBase::getTestCaseName(cpuParams);
         return result.str();
     }
 
@@ -50,10 +53,15 @@ protected:
         double alpha, beta, bias;
         size_t size;
         std::vector<int64_t> axes;
-        std::tie(inputPrecision, inputShapes, alpha, beta, bias, size, axes) = this->GetParam();
+        CPUSpecificParams cpuParams;
+        std::tie(inputPrecision, inputShapes, alpha, beta, bias, size, axes, cpuParams) = this->GetParam();
 
         init_input_shapes({ inputShapes });
-        selectedType = makeSelectedTypeStr("ref_any", inputPrecision);
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        if (selectedType.empty()) {
+            selectedType = "ref_any";
+        }
+        selectedType = makeSelectedTypeStr(selectedType, inputPrecision);
 
         auto params = ngraph::builder::makeDynamicParams(inputPrecision, { inputDynamicShapes });
         auto axesNode = ngraph::opset1::Constant::create(ngraph::element::i32, { axes.size() }, axes);
@@ -114,9 +122,40 @@ const auto testCases = ::testing::Combine(
     ::testing::ValuesIn(beta),
     ::testing::ValuesIn(bias),
     ::testing::ValuesIn(size),
-    ::testing::ValuesIn(axes)
+    ::testing::ValuesIn(axes),
+    ::testing::Values(emptyCPUSpec)
 );
 
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, LRNLayerCPUTest, testCases, LRNLayerCPUTest::getTestCaseName);
 
+// oneDNN has the JIT implementations of the channels last layout for the reduction across the blocks of 8 or 16
+// channels on AVX2 and higher, the reference one is used otherwise
+const std::vector<CPUSpecificParams> cpuParamsNhwc = {
+    CPUSpecificParams({nhwc}, {nhwc}, {}, InferenceEngine::with_cpu_x86_avx512f() ? "jit_avx512" :
+                                          InferenceEngine::with_cpu_x86_avx2() ? "jit_avx2" : "ref_any"),
+};
+
+const std::vector<InputShape> inputShapesNhwc = {
+    InputShape{{}, {{2, 16, 7, 8}}},
+    InputShape{
+        // dynamic
+        {-1, 16, -1, -1},
+        // static
+        {{2, 16, 7, 8}, {1, 16, 5, 5}, {2, 16, 7, 8}}
+    },
+};
+
+const auto testCasesNhwc = ::testing::Combine(
+    ::testing::ValuesIn(inputPrecisions),
+    ::testing::ValuesIn(inputShapesNhwc),
+    ::testing::ValuesIn(alpha),
+    ::testing::ValuesIn(beta),
+    ::testing::ValuesIn(bias),
+    ::testing::ValuesIn(size),
+    ::testing::Values(std::vector<int64_t>{ 1 }),
+    ::testing::ValuesIn(cpuParamsNhwc)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_nhwc, LRNLayerCPUTest, testCasesNhwc, LRNLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
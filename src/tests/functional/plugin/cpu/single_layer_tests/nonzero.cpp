@@ -182,7 +182,10 @@ std::vector<ngraph::Shape> inShapesStatic = {
         { 4, 100 },
         { 4, 2, 100 },
         { 4, 4, 2, 100 },
-        { 4, 4, 4, 2, 100 }
+        { 4, 4, 4, 2, 100 },
+        // split between several threads, the chunks start in the middle of rows
+        { 70001 },
+        { 8, 3, 1031 }
 };
 
 const auto paramsStatic = ::testing::Combine(
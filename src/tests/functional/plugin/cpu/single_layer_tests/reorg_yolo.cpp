@@ -48,7 +48,7 @@ protected:
 
         init_input_shapes({inputShape});
 
-        auto param = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, inputDynamicShapes[0]);
+        auto param = std::make_shared<ngraph::op::Parameter>(netPrecision, inputDynamicShapes[0]);
         auto reorg_yolo = std::make_shared<ngraph::op::v0::ReorgYolo>(param, stride);
         function = std::make_shared<ngraph::Function>(std::make_shared<ngraph::opset1::Result>(reorg_yolo),
                                                       ngraph::ParameterVector{param},
@@ -77,6 +77,19 @@ const auto testCase_stride3_Dynamic = ::testing::Combine(::testing::ValuesIn(inS
                                                          ::testing::Values(ov::element::f32),
                                                          ::testing::Values(CommonTestUtils::DEVICE_CPU));
 
+// the data is moved in the network precision without conversions
+const std::vector<ov::test::InputShape> inShapesStatic = {{{}, {{1, 64, 26, 26}}}, {{}, {{2, 12, 6, 10}}}};
+
+const auto testCase_stride2_Static = ::testing::Combine(::testing::ValuesIn(inShapesStatic),
+                                                        ::testing::Values(strides[0]),
+                                                        ::testing::Values(ov::element::f32, ov::element::bf16, ov::element::i8),
+                                                        ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_SUITE_P(smoke_TestsReorgYolo_stride2_StaticShape,
+                         ReorgYoloLayerCPUTest,
+                         testCase_stride2_Static,
+                         ReorgYoloLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_TestsReorgYolo_stride2_DynamicShape,
                          ReorgYoloLayerCPUTest,
                          testCase_stride2_Dynamic,
@@ -0,0 +1,142 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+#include <sstream>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The exported network carries the weights repacked by the graph, the imported network must take them instead of
+   repacking and produce the same results. The blob without the packed weights section must still be imported.
+
+    Param
+      |
+    Conv
+      |
+    Conv
+      |
+    Result
+*/
+class ExportImportPackedWeightsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+        param->get_output_tensor(0).set_names({"input"});
+        auto conv1 = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 32);
+        auto conv2 = builder::makeConvolution(conv1, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        conv2->get_output_tensor(0).set_names({"output"});
+        auto result = std::make_shared<opset8::Result>(conv2);
+        model = std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    std::vector<float> infer(ov::CompiledModel& compiledModel) {
+        ov::Tensor input(element::f32, shape);
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+
+        auto req = compiledModel.create_infer_request();
+        req.set_tensor("input", input);
+        req.infer();
+        const auto output = req.get_tensor("output");
+        return std::vector<float>(output.data<const float>(), output.data<const float>() + output.get_size());
+    }
+
+    const Shape shape{1, 16, 20, 20};
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(ExportImportPackedWeightsTest, smoke_ImportedNetworkMatchesCompiled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    const auto reference = infer(compiledModel);
+
+    std::stringstream blob;
+    compiledModel.export_model(blob);
+    const auto blobStr = blob.str();
+    const auto sectionPos = blobStr.rfind("OVPW");
+    ASSERT_NE(sectionPos, std::string::npos) << "The packed weights section is not exported";
+
+    std::stringstream importBlob(blobStr);
+    auto importedModel = core->import_model(importBlob, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(infer(importedModel), reference);
+
+    // a blob exported without the section, the weights are packed on import
+    std::stringstream legacyBlob(blobStr.substr(0, sectionPos));
+    auto legacyModel = core->import_model(legacyBlob, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(infer(legacyModel), reference);
+}
+
+// HETERO imports the subnetworks one by one from the same stream, each import must stop at the end of its blob
+TEST_F(ExportImportPackedWeightsTest, smoke_ConcatenatedBlobsAreImported) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    const auto reference = infer(compiledModel);
+
+    std::stringstream blob;
+    compiledModel.export_model(blob);
+    const auto blobStr = blob.str();
+    const auto sectionPos = blobStr.rfind("OVPW");
+    ASSERT_NE(sectionPos, std::string::npos) << "The packed weights section is not exported";
+
+    // the section of another target: magic, version, section size, target size, then the target
+    auto foreignStr = blobStr;
+    const auto targetPos = sectionPos + sizeof(uint32_t) * 2 + sizeof(uint64_t) * 2;
+    ASSERT_LT(targetPos, foreignStr.size());
+    foreignStr[targetPos] ^= 0x1;
+
+    std::stringstream stream(foreignStr + blobStr.substr(0, sectionPos) + blobStr);
+    for (size_t i = 0; i < 3; i++) {
+        auto importedModel = core->import_model(stream, CommonTestUtils::DEVICE_CPU);
+        ASSERT_EQ(infer(importedModel), reference) << "blob: " << i;
+    }
+}
+
+// the memory descriptor is read from the blob as is, the corrupted one must not reach oneDNN
+TEST_F(ExportImportPackedWeightsTest, smoke_CorruptedDescriptorIsNotImported) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+
+    std::stringstream blob;
+    compiledModel.export_model(blob);
+    const auto blobStr = blob.str();
+    const auto sectionPos = blobStr.rfind("OVPW");
+    ASSERT_NE(sectionPos, std::string::npos) << "The packed weights section is not exported";
+
+    // magic, version, section size, then the target, the weights count and the key of the first weights
+    auto readSize = [&](size_t pos) {
+        uint64_t size = 0;
+        blobStr.copy(reinterpret_cast<char*>(&size), sizeof(size), pos);
+        return static_cast<size_t>(size);
+    };
+    const auto targetPos = sectionPos + sizeof(uint32_t) * 2 + sizeof(uint64_t);
+    const auto keyPos = targetPos + sizeof(uint64_t) + readSize(targetPos) + sizeof(uint64_t);
+    ASSERT_LT(keyPos + sizeof(uint64_t), blobStr.size());
+    ASSERT_GT(readSize(keyPos - sizeof(uint64_t)), 0u) << "No packed weights are exported";
+    const auto descPos = keyPos + sizeof(uint64_t) + readSize(keyPos);
+    ASSERT_LT(descPos + sizeof(int), blobStr.size());
+
+    // ndims is the first field of the descriptor
+    for (int ndims : {0, -1, 1000}) {
+        auto corruptedStr = blobStr;
+        corruptedStr.replace(descPos, sizeof(ndims), reinterpret_cast<const char*>(&ndims), sizeof(ndims));
+        std::stringstream corrupted(corruptedStr);
+        ASSERT_THROW(core->import_model(corrupted, CommonTestUtils::DEVICE_CPU), ov::Exception) << "ndims: " << ndims;
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
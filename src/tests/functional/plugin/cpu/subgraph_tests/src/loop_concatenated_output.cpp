@@ -0,0 +1,177 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The outputs of the iterations are concatenated right in the output buffer (or in the growing buffer for the
+   dynamic trip count) and the back edge is passed between the iterations without copying.
+
+              Param   TripCount
+                 \     /
+                  Loop:  X -> Add(1) -> X (back edge)
+                 /    \
+     Concat of X's    Last X
+*/
+class LoopConcatenatedOutputTest : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override {
+        const bool dynamicTripCount = GetParam();
+
+        auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, hiddenSize});
+        param->get_output_tensor(0).set_names({"input"});
+        ParameterVector params{param};
+        std::shared_ptr<Node> tripCount;
+        if (dynamicTripCount) {
+            auto tripCountParam = std::make_shared<opset8::Parameter>(element::i64, Shape{1});
+            tripCountParam->get_output_tensor(0).set_names({"trip_count"});
+            params.push_back(tripCountParam);
+            tripCount = tripCountParam;
+        } else {
+            tripCount = opset8::Constant::create(element::i64, Shape{1}, {iterations});
+        }
+
+        auto bodyParam = std::make_shared<opset8::Parameter>(element::f32, Shape{1, hiddenSize});
+        auto add = std::make_shared<opset8::Add>(bodyParam, opset8::Constant::create(element::f32, Shape{1}, {1.f}));
+        auto bodyCondition = opset8::Constant::create(element::boolean, Shape{1}, {true});
+        auto body = std::make_shared<ov::Model>(OutputVector{bodyCondition, add}, ParameterVector{bodyParam});
+
+        auto execCondition = opset8::Constant::create(element::boolean, Shape{1}, {true});
+        auto loop = std::make_shared<opset8::Loop>(tripCount, execCondition);
+        loop->set_function(body);
+        loop->set_special_body_ports(opset8::Loop::SpecialBodyPorts{-1, 0});
+        loop->set_merged_input(bodyParam, param, add);
+        auto concatenated = loop->get_concatenated_slices(add, 0, 1, 1, -1, 0);
+        auto last = loop->get_iter_value(add, -1);
+        concatenated.get_tensor().set_names({"concatenated"});
+        last.get_tensor().set_names({"last"});
+
+        model = std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(concatenated),
+                                                         std::make_shared<opset8::Result>(last)},
+                                            params);
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    }
+
+    ov::InferRequest createRequest() {
+        auto req = compiledModel.create_infer_request();
+        ov::Tensor input(element::f32, Shape{1, hiddenSize});
+        std::fill_n(input.data<float>(), input.get_size(), 0.5f);
+        req.set_tensor("input", input);
+        if (GetParam()) {
+            ov::Tensor tripCount(element::i64, Shape{1});
+            tripCount.data<int64_t>()[0] = iterations;
+            req.set_tensor("trip_count", tripCount);
+        }
+        return req;
+    }
+
+    static constexpr size_t hiddenSize = 16;
+    static constexpr int64_t iterations = 300;
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+};
+
+constexpr size_t LoopConcatenatedOutputTest::hiddenSize;
+constexpr int64_t LoopConcatenatedOutputTest::iterations;
+
+TEST_P(LoopConcatenatedOutputTest, smoke_OutputsAreConcatenated) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto req = createRequest();
+    // the buffers are reused by the following inferences
+    for (size_t inference = 0; inference < 2; inference++) {
+        req.infer();
+
+        const auto concatenated = req.get_tensor("concatenated");
+        ASSERT_EQ(concatenated.get_shape(), (Shape{static_cast<size_t>(iterations), hiddenSize}));
+        const auto data = concatenated.data<const float>();
+        for (size_t i = 0; i < concatenated.get_size(); i++)
+            ASSERT_EQ(data[i], 0.5f + static_cast<float>(i / hiddenSize + 1)) << "index: " << i;
+
+        const auto last = req.get_tensor("last");
+        ASSERT_EQ(last.get_shape(), (Shape{1, hiddenSize}));
+        for (size_t i = 0; i < last.get_size(); i++)
+            ASSERT_EQ(last.data<const float>()[i], 0.5f + static_cast<float>(iterations)) << "index: " << i;
+    }
+}
+
+/* The shape of the body and the trip count change between the inferences, so the chunks of the growing buffer
+   change and the body output written in place must not refer the buffer released by the previous inferences.
+
+              Param[1, ?]   TripCount
+                 \        /
+                  Loop:  X -> Add(1) -> X (back edge)
+                    |
+              Concat of X's
+*/
+class LoopConcatenatedDynamicOutputTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, PartialShape{1, -1});
+        param->get_output_tensor(0).set_names({"input"});
+        auto tripCount = std::make_shared<opset8::Parameter>(element::i64, Shape{1});
+        tripCount->get_output_tensor(0).set_names({"trip_count"});
+
+        auto bodyParam = std::make_shared<opset8::Parameter>(element::f32, PartialShape{1, -1});
+        auto add = std::make_shared<opset8::Add>(bodyParam, opset8::Constant::create(element::f32, Shape{1}, {1.f}));
+        auto bodyCondition = opset8::Constant::create(element::boolean, Shape{1}, {true});
+        auto body = std::make_shared<ov::Model>(OutputVector{bodyCondition, add}, ParameterVector{bodyParam});
+
+        auto execCondition = opset8::Constant::create(element::boolean, Shape{1}, {true});
+        auto loop = std::make_shared<opset8::Loop>(tripCount, execCondition);
+        loop->set_function(body);
+        loop->set_special_body_ports(opset8::Loop::SpecialBodyPorts{-1, 0});
+        loop->set_merged_input(bodyParam, param, add);
+        auto concatenated = loop->get_concatenated_slices(add, 0, 1, 1, -1, 0);
+        concatenated.get_tensor().set_names({"concatenated"});
+
+        model = std::make_shared<ov::Model>(ResultVector{std::make_shared<opset8::Result>(concatenated)},
+                                            ParameterVector{param, tripCount});
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    }
+
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(LoopConcatenatedDynamicOutputTest, smoke_BodyShapeChangesBetweenInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto req = compiledModel.create_infer_request();
+    // the sizes of the chunks aligned for the in place writes and the unaligned one
+    const std::vector<std::pair<size_t, int64_t>> inferences{
+        {16, 300}, {64, 7}, {3, 100}, {32, 1000}, {16, 1}, {64, 500}};
+    for (const auto& inference : inferences) {
+        const auto hiddenSize = inference.first;
+        const auto iterations = inference.second;
+        ov::Tensor input(element::f32, Shape{1, hiddenSize});
+        std::fill_n(input.data<float>(), input.get_size(), 0.5f);
+        req.set_tensor("input", input);
+        ov::Tensor tripCount(element::i64, Shape{1});
+        tripCount.data<int64_t>()[0] = iterations;
+        req.set_tensor("trip_count", tripCount);
+        req.infer();
+
+        const auto concatenated = req.get_tensor("concatenated");
+        ASSERT_EQ(concatenated.get_shape(), (Shape{static_cast<size_t>(iterations), hiddenSize}));
+        const auto data = concatenated.data<const float>();
+        for (size_t i = 0; i < concatenated.get_size(); i++)
+            ASSERT_EQ(data[i], 0.5f + static_cast<float>(i / hiddenSize + 1))
+                << "hidden size: " << hiddenSize << " index: " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopConcatenatedOutput, LoopConcatenatedOutputTest, ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                             return info.param ? "DynamicTripCount" : "StaticTripCount";
+                         });
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,103 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The compressed weights are kept compressed and decompressed by FullyConnected on the fly, the results must match
+   the network compiled with the weights decompressed on the compilation.
+
+              Constant(FP16 / U8)
+                  |
+    Param      Convert
+      |           |
+      |       [Subtract(Constant)]
+      |           |
+      |       [Multiply(Constant)]
+      |           |
+       \         /
+         MatMul
+           |
+         Result
+*/
+class MatMulCompressedWeightsTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> makeModel(element::Type weightsPrecision, bool withZeroPointAndScale) {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, inputShape);
+        param->get_output_tensor(0).set_names({"input"});
+
+        std::vector<float> weightsValues(IC * OC);
+        for (size_t i = 0; i < weightsValues.size(); i++)
+            weightsValues[i] = static_cast<float>(i % 13);
+        auto weights = opset8::Constant::create(weightsPrecision, Shape{IC, OC}, weightsValues);
+        std::shared_ptr<Node> decompression = std::make_shared<opset8::Convert>(weights, element::f32);
+        if (withZeroPointAndScale) {
+            auto zeroPoint = opset8::Constant::create(element::f32, Shape{OC}, std::vector<float>(OC, 6.f));
+            decompression = std::make_shared<opset8::Subtract>(decompression, zeroPoint);
+            std::vector<float> scaleValues(OC);
+            for (size_t i = 0; i < OC; i++)
+                scaleValues[i] = 0.01f * static_cast<float>(i + 1);
+            auto scale = opset8::Constant::create(element::f32, Shape{OC}, scaleValues);
+            decompression = std::make_shared<opset8::Multiply>(decompression, scale);
+        }
+
+        auto matMul = std::make_shared<opset8::MatMul>(param, decompression);
+        matMul->get_output_tensor(0).set_names({"output"});
+        auto result = std::make_shared<opset8::Result>(matMul);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    std::vector<float> infer(const std::shared_ptr<ov::Model>& model, bool compressedWeights) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        ov::AnyMap config;
+        if (compressedWeights)
+            config["CPU_COMPRESSED_WEIGHTS"] = "YES";
+        auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+
+        ov::Tensor input(element::f32, inputShape);
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>(i % 7) / 7.f - 0.5f;
+
+        auto req = compiledModel.create_infer_request();
+        req.set_tensor("input", input);
+        req.infer();
+        const auto output = req.get_tensor("output");
+        return std::vector<float>(output.data<const float>(), output.data<const float>() + output.get_size());
+    }
+
+    void compare(const std::vector<float>& actual, const std::vector<float>& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); i++)
+            ASSERT_NEAR(actual[i], expected[i], 1e-3f * std::max(1.f, std::abs(expected[i]))) << "index: " << i;
+    }
+
+    static constexpr size_t IC = 64;
+    static constexpr size_t OC = 32;
+    const Shape inputShape{4, IC};
+};
+
+constexpr size_t MatMulCompressedWeightsTest::IC;
+constexpr size_t MatMulCompressedWeightsTest::OC;
+
+TEST_F(MatMulCompressedWeightsTest, smoke_FP16WeightsMatchDecompressed) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto model = makeModel(element::f16, false);
+    compare(infer(model, true), infer(model, false));
+}
+
+TEST_F(MatMulCompressedWeightsTest, smoke_U8WeightsWithZeroPointAndScaleMatchDecompressed) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto model = makeModel(element::u8, true);
+    compare(infer(model, true), infer(model, false));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,215 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/op/util/variable.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The dynamic state grows by the new tokens of each step like the key-value cache of the decoder. The state is
+   appended in place by Concat, the state of each step must contain the tokens of all the previous steps.
+
+    ReadValue   Param
+           \    /
+           Concat
+           /    \
+       Assign  Result
+*/
+class MemoryStateAppendTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, PartialShape{1, -1, hiddenSize});
+        param->get_output_tensor(0).set_names({"input"});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{PartialShape{1, -1, hiddenSize}, element::f32, "cache"});
+        auto init = opset8::Constant::create(element::f32, Shape{1, 0, hiddenSize}, std::vector<float>{});
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+        auto concat = std::make_shared<opset8::Concat>(OutputVector{readValue, param}, 1);
+        concat->get_output_tensor(0).set_names({"output"});
+        auto assign = std::make_shared<opset8::Assign>(concat, variable);
+        auto result = std::make_shared<opset8::Result>(concat);
+        model = std::make_shared<ov::Model>(ResultVector{result}, ov::SinkVector{assign}, ParameterVector{param});
+
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    }
+
+    // the tokens of the step are filled by the step number
+    ov::Tensor makeTokens(size_t tokens, float value) {
+        ov::Tensor tensor(element::f32, Shape{1, tokens, hiddenSize});
+        std::fill_n(tensor.data<float>(), tensor.get_size(), value);
+        return tensor;
+    }
+
+    // checks that the cache holds the tokens of the steps 1, 2, ... with the given number of tokens per step
+    void checkCache(const ov::Tensor& cache, size_t steps, size_t tokensPerStep) {
+        ASSERT_EQ(cache.get_shape(), (Shape{1, steps * tokensPerStep, hiddenSize}));
+        const auto data = cache.data<const float>();
+        for (size_t i = 0; i < cache.get_size(); i++)
+            ASSERT_EQ(data[i], static_cast<float>(i / (tokensPerStep * hiddenSize) + 1)) << "index: " << i;
+    }
+
+    static constexpr size_t hiddenSize = 8;
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+};
+
+constexpr size_t MemoryStateAppendTest::hiddenSize;
+
+TEST_F(MemoryStateAppendTest, smoke_StateIsAppended) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto req = compiledModel.create_infer_request();
+    const size_t tokensPerStep = 3;
+    for (size_t step = 1; step <= 40; step++) {
+        req.set_tensor("input", makeTokens(tokensPerStep, static_cast<float>(step)));
+        req.infer();
+        checkCache(req.get_tensor("output"), step, tokensPerStep);
+        auto states = req.query_state();
+        ASSERT_EQ(states.size(), 1u);
+        checkCache(states[0].get_state(), step, tokensPerStep);
+    }
+
+    // the states of the requests are independent
+    auto otherReq = compiledModel.create_infer_request();
+    otherReq.set_tensor("input", makeTokens(tokensPerStep, 1.f));
+    otherReq.infer();
+    checkCache(otherReq.get_tensor("output"), 1, tokensPerStep);
+
+    auto state = req.query_state()[0];
+    state.reset();
+    ASSERT_EQ(state.get_state().get_shape(), (Shape{1, 0, hiddenSize}));
+    req.set_tensor("input", makeTokens(tokensPerStep, 1.f));
+    req.infer();
+    checkCache(req.get_tensor("output"), 1, tokensPerStep);
+
+    state.set_state(makeTokens(tokensPerStep, 1.f));
+    req.set_tensor("input", makeTokens(tokensPerStep, 2.f));
+    req.infer();
+    checkCache(req.get_tensor("output"), 2, tokensPerStep);
+}
+
+/* The [batch, heads, length, size] key-value cache with the dynamic batch is appended in place with the strided
+   layout along the length, the attention scores read the cache in place.
+
+    ReadValue   Param(keys)
+           \    /
+           Concat   Param(query)
+           /    \   /
+       Assign  MatMul(transpose_b)
+                  |
+                Result
+*/
+class MemoryStateAppendHeadsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const PartialShape cacheShape{-1, heads, -1, size};
+        auto keys = std::make_shared<opset8::Parameter>(element::f32, cacheShape);
+        keys->get_output_tensor(0).set_names({"keys"});
+        auto query = std::make_shared<opset8::Parameter>(element::f32, PartialShape{-1, heads, 1, size});
+        query->get_output_tensor(0).set_names({"query"});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{cacheShape, element::f32, "cache"});
+        auto init = opset8::Constant::create(element::f32, Shape{1, heads, 0, size}, std::vector<float>{});
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+        auto concat = std::make_shared<opset8::Concat>(OutputVector{readValue, keys}, 2);
+        auto assign = std::make_shared<opset8::Assign>(concat, variable);
+        auto scores = std::make_shared<opset8::MatMul>(query, concat, false, true);
+        scores->get_output_tensor(0).set_names({"scores"});
+        auto result = std::make_shared<opset8::Result>(scores);
+        model = std::make_shared<ov::Model>(ResultVector{result}, ov::SinkVector{assign},
+                                            ParameterVector{keys, query});
+
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    }
+
+    static float tokenValue(size_t b, size_t h, size_t step) {
+        return static_cast<float>(step + 10 * h + 100 * b);
+    }
+
+    ov::Tensor makeKeys(size_t tokens, size_t step) {
+        ov::Tensor tensor(element::f32, Shape{batch, heads, tokens, size});
+        auto data = tensor.data<float>();
+        for (size_t b = 0; b < batch; b++)
+            for (size_t h = 0; h < heads; h++)
+                std::fill_n(data + (b * heads + h) * tokens * size, tokens * size, tokenValue(b, h, step));
+        return tensor;
+    }
+
+    ov::Tensor makeQuery() {
+        ov::Tensor tensor(element::f32, Shape{batch, heads, 1, size});
+        std::fill_n(tensor.data<float>(), tensor.get_size(), 1.f);
+        return tensor;
+    }
+
+    // the cache holds the tokens of the steps 1, 2, ... with the given number of tokens per step
+    void checkCache(const ov::Tensor& cache, size_t steps, size_t tokensPerStep) {
+        const auto length = steps * tokensPerStep;
+        ASSERT_EQ(cache.get_shape(), (Shape{batch, heads, length, size}));
+        const auto data = cache.data<const float>();
+        for (size_t i = 0; i < cache.get_size(); i++) {
+            const auto token = i / size % length;
+            const auto row = i / (size * length);
+            ASSERT_EQ(data[i], tokenValue(row / heads, row % heads, token / tokensPerStep + 1)) << "index: " << i;
+        }
+    }
+
+    // the query of ones sums the values of each token
+    void checkScores(const ov::Tensor& scores, size_t steps, size_t tokensPerStep) {
+        const auto length = steps * tokensPerStep;
+        ASSERT_EQ(scores.get_shape(), (Shape{batch, heads, 1, length}));
+        const auto data = scores.data<const float>();
+        for (size_t i = 0; i < scores.get_size(); i++) {
+            const auto row = i / length;
+            const auto expected = size * tokenValue(row / heads, row % heads, i % length / tokensPerStep + 1);
+            ASSERT_NEAR(data[i], expected, 1e-3f * expected) << "index: " << i;
+        }
+    }
+
+    static constexpr size_t batch = 2;
+    static constexpr size_t heads = 3;
+    static constexpr size_t size = 8;
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+};
+
+constexpr size_t MemoryStateAppendHeadsTest::batch;
+constexpr size_t MemoryStateAppendHeadsTest::heads;
+constexpr size_t MemoryStateAppendHeadsTest::size;
+
+TEST_F(MemoryStateAppendHeadsTest, smoke_StateIsAppendedPerHead) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto req = compiledModel.create_infer_request();
+    req.set_tensor("query", makeQuery());
+    const size_t tokensPerStep = 3;
+    for (size_t step = 1; step <= 12; step++) {
+        req.set_tensor("keys", makeKeys(tokensPerStep, step));
+        req.infer();
+        checkScores(req.get_tensor("scores"), step, tokensPerStep);
+        checkCache(req.query_state()[0].get_state(), step, tokensPerStep);
+    }
+
+    // the batch and the heads are kept on reset
+    auto state = req.query_state()[0];
+    state.reset();
+    ASSERT_EQ(state.get_state().get_shape(), (Shape{batch, heads, 0, size}));
+    req.set_tensor("keys", makeKeys(tokensPerStep, 1));
+    req.infer();
+    checkScores(req.get_tensor("scores"), 1, tokensPerStep);
+
+    // the dense state set by the user is appended as well
+    state.set_state(makeKeys(tokensPerStep, 1));
+    req.set_tensor("keys", makeKeys(tokensPerStep, 2));
+    req.infer();
+    checkScores(req.get_tensor("scores"), 2, tokensPerStep);
+    checkCache(state.get_state(), 2, tokensPerStep);
+}
+
+} // namespace SubgraphTestsDefinitions
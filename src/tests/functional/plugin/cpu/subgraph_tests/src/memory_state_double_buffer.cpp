@@ -0,0 +1,90 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/op/util/variable.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The state is kept in two buffers swapped after each inference, the state of each step must be the sum of the
+   inputs of all the previous steps. The state is read and written by the views without copying.
+
+    Param   ReadValue
+       \    /
+        Add
+       /   \
+   Assign  Result
+*/
+class MemoryStateDoubleBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+        param->get_output_tensor(0).set_names({"input"});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, element::f32, "state"});
+        auto init = opset8::Constant::create(element::f32, shape, {0.f});
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+        auto add = std::make_shared<opset8::Add>(readValue, param);
+        add->get_output_tensor(0).set_names({"output"});
+        auto assign = std::make_shared<opset8::Assign>(add, variable);
+        auto result = std::make_shared<opset8::Result>(add);
+        model = std::make_shared<ov::Model>(ResultVector{result}, ov::SinkVector{assign}, ParameterVector{param});
+
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU);
+    }
+
+    static float stateValue(const ov::Tensor& tensor) {
+        return tensor.data<const float>()[0];
+    }
+
+    const Shape shape{1, 16};
+    std::shared_ptr<ov::Model> model;
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(MemoryStateDoubleBufferTest, smoke_StateIsAccumulated) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto req = compiledModel.create_infer_request();
+    ov::Tensor input(element::f32, shape);
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+    req.set_tensor("input", input);
+
+    for (size_t step = 1; step <= 5; step++) {
+        req.infer();
+        ASSERT_EQ(stateValue(req.get_tensor("output")), static_cast<float>(step));
+        auto states = req.query_state();
+        ASSERT_EQ(states.size(), 1u);
+        ASSERT_EQ(stateValue(states[0].get_state()), static_cast<float>(step));
+    }
+
+    // the states of the requests are independent
+    auto otherReq = compiledModel.create_infer_request();
+    otherReq.set_tensor("input", input);
+    otherReq.infer();
+    ASSERT_EQ(stateValue(otherReq.get_tensor("output")), 1.f);
+
+    auto state = req.query_state()[0];
+    ov::Tensor newState(element::f32, shape);
+    std::fill_n(newState.data<float>(), newState.get_size(), 10.f);
+    state.set_state(newState);
+    // the state is copied, the tensor of the caller is not used by the inferences
+    std::fill_n(newState.data<float>(), newState.get_size(), 100.f);
+    req.infer();
+    ASSERT_EQ(stateValue(req.get_tensor("output")), 11.f);
+    req.infer();
+    ASSERT_EQ(stateValue(req.get_tensor("output")), 12.f);
+
+    state.reset();
+    req.infer();
+    ASSERT_EQ(stateValue(req.get_tensor("output")), 1.f);
+    ASSERT_EQ(stateValue(state.get_state()), 1.f);
+}
+
+} // namespace SubgraphTestsDefinitions
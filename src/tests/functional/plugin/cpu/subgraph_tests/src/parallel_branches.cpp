@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* Inception-like block. The branches have no data dependencies between each other, so
+   with CPU_PARALLEL_BRANCHES they are executed concurrently and their edges must not share memory.
+
+            Param
+      /     |      |      \
+   Conv1  Conv3  Conv5   MaxPool
+     |      |      |       |
+   Relu   Relu   Sigmoid  Conv1
+      \     |      |      /
+             Concat
+*/
+class ParallelBranchesCPUTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 20, 20}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, 8);
+        };
+
+        auto branch1 = builder::makeActivation(makeConv(paramOuts[0], 1), ngPrc, helpers::ActivationTypes::Relu);
+        auto branch2 = builder::makeActivation(makeConv(paramOuts[0], 3), ngPrc, helpers::ActivationTypes::Relu);
+        auto branch3 = builder::makeActivation(makeConv(paramOuts[0], 5), ngPrc, helpers::ActivationTypes::Sigmoid);
+        auto pool = builder::makePooling(paramOuts[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch4 = makeConv(pool, 1);
+
+        auto concat = std::make_shared<op::v0::Concat>(OutputVector{branch1, branch2, branch3, branch4}, 1);
+
+        function = std::make_shared<Function>(NodeVector{concat}, inputParams, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesCPUTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+/* Many wide branches, the kernels of each branch run the parallel loops. The threads waiting in the loops of one
+   branch must not start the other branches, otherwise the branches run over the same thread local state and the
+   oneDNN scratchpad of the thread.
+
+          Param
+      /     |     \
+   Conv3  Conv3 ... Conv3   x branches
+     |      |       |
+   Relu   Relu ... Relu
+      \     |     /
+          Concat
+*/
+class ParallelWideBranchesCPUTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 32, 56, 56}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        OutputVector branches;
+        for (size_t branch = 0; branch < 16; branch++) {
+            auto conv = builder::makeConvolution(paramOuts[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 op::PadType::EXPLICIT, 32);
+            branches.push_back(builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu));
+        }
+        auto concat = std::make_shared<op::v0::Concat>(branches, 1);
+
+        function = std::make_shared<Function>(NodeVector{concat}, inputParams, "ParallelWideBranches");
+    }
+};
+
+TEST_F(ParallelWideBranchesCPUTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the branches are scheduled differently on each inference
+    for (size_t i = 0; i < 10; i++) {
+        Infer();
+        Validate();
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The user tensors which are compatible with the graph ports must be used by the graph edges directly,
+   the profiling info reports the binding type of each port, the records are named after the legacy port names.
+
+    Param0  Param1
+        \    /
+         Add
+          |
+        Result
+*/
+class ZeroCopyIOTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param0 = std::make_shared<opset8::Parameter>(element::f32, shape);
+        param0->set_friendly_name("param_0");
+        param0->get_output_tensor(0).set_names({"input_0"});
+        auto param1 = std::make_shared<opset8::Parameter>(element::f32, shape);
+        param1->set_friendly_name("param_1");
+        param1->get_output_tensor(0).set_names({"input_1"});
+        auto add = std::make_shared<opset8::Add>(param0, param1);
+        add->set_friendly_name("add");
+        add->get_output_tensor(0).set_names({"output"});
+        auto result = std::make_shared<opset8::Result>(add);
+        model = std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param0, param1});
+    }
+
+    std::map<std::string, std::string> run(const ov::Tensor& input0, const ov::Tensor& input1, const ov::Tensor& output) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU, ov::enable_profiling(true));
+        auto req = compiledModel.create_infer_request();
+        req.set_tensor("input_0", input0);
+        req.set_tensor("input_1", input1);
+        req.set_tensor("output", output);
+        req.infer();
+
+        const auto in0 = input0.data<const float>();
+        const auto in1 = input1.data<const float>();
+        const auto out = output.data<const float>();
+        for (size_t i = 0; i < shape_size(shape); i++) {
+            EXPECT_EQ(out[i], in0[i] + in1[i]) << "element: " << i;
+        }
+
+        std::map<std::string, std::string> binding;
+        for (const auto& info : req.get_profiling_info()) {
+            if (info.node_type == "InputBinding" || info.node_type == "OutputBinding")
+                binding[info.node_name] = info.exec_type;
+        }
+        return binding;
+    }
+
+    static void fill(const ov::Tensor& tensor, float start) {
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            data[i] = start + static_cast<float>(i % 100);
+    }
+
+    const Shape shape{1, 3, 64, 64};
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(ZeroCopyIOTest, smoke_UserTensorsAreBound) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::vector<float> data0(shape_size(shape)), data1(shape_size(shape)), dataOut(shape_size(shape));
+    ov::Tensor input0(element::f32, shape, data0.data());
+    ov::Tensor input1(element::f32, shape, data1.data());
+    ov::Tensor output(element::f32, shape, dataOut.data());
+    fill(input0, 1.f);
+    fill(input1, -3.f);
+
+    const auto binding = run(input0, input1, output);
+    ASSERT_EQ(binding.size(), 3u);
+    EXPECT_EQ(binding.at("param_0_io_binding"), "zero_copy");
+    EXPECT_EQ(binding.at("param_1_io_binding"), "zero_copy");
+    EXPECT_EQ(binding.at("add_io_binding"), "zero_copy");
+}
+
+TEST_F(ZeroCopyIOTest, smoke_MisalignedTensorIsCopied) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::vector<float> data0(shape_size(shape)), dataOut(shape_size(shape));
+    // the data of the second input is not aligned to the element size
+    std::vector<uint8_t> data1(shape_size(shape) * sizeof(float) + 1);
+    ov::Tensor input0(element::f32, shape, data0.data());
+    ov::Tensor input1(element::f32, shape, data1.data() + 1);
+    ov::Tensor output(element::f32, shape, dataOut.data());
+    fill(input0, 1.f);
+    fill(input1, -3.f);
+
+    const auto binding = run(input0, input1, output);
+    EXPECT_EQ(binding.at("param_0_io_binding"), "zero_copy");
+    EXPECT_EQ(binding.at("param_1_io_binding"), "copy_incompatible_blob");
+    EXPECT_EQ(binding.at("add_io_binding"), "zero_copy");
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -883,6 +883,39 @@ TEST_P(OVClassNetworkTestP, LoadNetworkActualNoThrow) {
     OV_ASSERT_NO_THROW(ie.compile_model(actualNetwork, deviceName));
 }
 
+TEST_P(OVClassNetworkTestP, CompileModelAsyncSeveralModelsNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    std::vector<std::future<ov::CompiledModel>> futures;
+    for (const auto& model : {actualNetwork, simpleNetwork, multinputNetwork, ksoNetwork}) {
+        futures.push_back(ie.compile_model_async(model, deviceName));
+    }
+    for (auto& future : futures) {
+        ov::CompiledModel compiledModel;
+        OV_ASSERT_NO_THROW(compiledModel = future.get());
+        OV_ASSERT_NO_THROW(compiledModel.create_infer_request());
+    }
+}
+
+TEST_P(OVClassNetworkTestP, CompileModelAsyncWithWarmUpNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    const auto inputShape = simpleNetwork->input().get_shape();
+    // the static shapes of the model and the explicit ones
+    auto future = ie.compile_model_async(simpleNetwork, deviceName, {}, {{}, {inputShape}});
+    ov::CompiledModel compiledModel;
+    OV_ASSERT_NO_THROW(compiledModel = future.get());
+    OV_ASSERT_NO_THROW(compiledModel.create_infer_request().infer());
+}
+
+TEST_P(OVClassNetworkTestP, CompileModelAsyncWithWrongWarmUpShapesNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    const auto inputShape = simpleNetwork->input().get_shape();
+    // the wrong set is skipped by the warm-up, the compiled model is returned anyway
+    auto future = ie.compile_model_async(simpleNetwork, deviceName, {}, {{inputShape, inputShape}, {inputShape}});
+    ov::CompiledModel compiledModel;
+    OV_ASSERT_NO_THROW(compiledModel = future.get());
+    OV_ASSERT_NO_THROW(compiledModel.create_infer_request().infer());
+}
+
 TEST_P(OVClassNetworkTestP, LoadNetworkActualHeteroDeviceNoThrow) {
     ov::Core ie = createCoreWithTemplate();
     OV_ASSERT_NO_THROW(ie.compile_model(actualNetwork, CommonTestUtils::DEVICE_HETERO + std::string(":") + deviceName));
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -58,6 +59,7 @@ protected:
         }
 
         auto ie = InferenceEngine::Core();
+        std::vector<ExecutableNetwork> exec_nets;
         std::vector<std::string> outputs;
         std::vector<InferRequest> irs;
         std::vector<std::vector<uint8_t>> ref;
@@ -79,6 +81,7 @@ protected:
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     device_name + "(" + std::to_string(num_batch) + ")",
                                                config);
+            exec_nets.push_back(exec_net_ref);
 
             auto network_outputs = net.getOutputsInfo();
             ASSERT_EQ(network_outputs.size(), 1) << " Auto-Batching tests use networks with single output";
@@ -136,6 +139,18 @@ protected:
                                              outElementsCount[i],
                                              thr);
         }
+
+        if (num_batch > 1) {
+            // every request is either executed with the (full or partial) batch or with batch1 on the timeout
+            for (auto& exec_net : exec_nets) {
+                const auto stats = exec_net.GetMetric("AUTO_BATCH_STATISTICS").as<std::map<std::string, uint64_t>>();
+                ASSERT_EQ(stats.at("requests"), num_requests * niter);
+                ASSERT_LE(stats.at("batch1_requests"), num_requests * niter);
+                const auto occupancy = exec_net.GetMetric("AUTO_BATCH_OCCUPANCY").as<float>();
+                ASSERT_GT(occupancy, 0.f);
+                ASSERT_LE(occupancy, 1.f);
+            }
+        }
     }
 };
 
@@ -0,0 +1,46 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        ov::Shape,                   // Input 0 Shape
+        size_t,                      // Expected num nodes
+        size_t,                      // Expected num subgraphs
+        std::string                  // Target Device
+> ReduceEltwiseParams;
+
+class SoftmaxReduceEltwise : public testing::WithParamInterface<ov::test::snippets::ReduceEltwiseParams>,
+                             virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::ReduceEltwiseParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+class LayerNormReduceEltwise : public SoftmaxReduceEltwise {
+protected:
+    void SetUp() override;
+};
+
+class MaxSubtractReduceEltwise : public SoftmaxReduceEltwise {
+protected:
+    void SetUp() override;
+};
+
+class ExpMeanReduceEltwise : public SoftmaxReduceEltwise {
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
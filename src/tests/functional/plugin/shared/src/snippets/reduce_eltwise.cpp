@@ -0,0 +1,85 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "snippets/reduce_eltwise.hpp"
+#include "subgraph_simple.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+    std::string SoftmaxReduceEltwise::getTestCaseName(testing::TestParamInfo<ov::test::snippets::ReduceEltwiseParams> obj) {
+        ov::Shape inputShapes0;
+        std::string targetDevice;
+        size_t num_nodes, num_subgraphs;
+        std::tie(inputShapes0, num_nodes, num_subgraphs, targetDevice) = obj.param;
+
+        std::ostringstream result;
+        result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes0) << "_";
+        result << "#N=" << num_nodes << "_";
+        result << "#S=" << num_subgraphs << "_";
+        result << "targetDevice=" << targetDevice;
+        return result.str();
+    }
+
+    void SoftmaxReduceEltwise::SetUp() {
+        ov::Shape inputShape0;
+        std::tie(inputShape0, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+        init_input_shapes({{{}, {inputShape0, }}});
+
+        auto f = ov::test::snippets::SoftmaxSinhFunction({inputShape0});
+        function = f.getOriginal();
+    }
+
+    void LayerNormReduceEltwise::SetUp() {
+        ov::Shape inputShape0;
+        std::tie(inputShape0, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+        init_input_shapes({{{}, {inputShape0, }}});
+
+        auto f = ov::test::snippets::LayerNormSinhFunction({inputShape0});
+        function = f.getOriginal();
+    }
+
+    void MaxSubtractReduceEltwise::SetUp() {
+        ov::Shape inputShape0;
+        std::tie(inputShape0, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+        init_input_shapes({{{}, {inputShape0, }}});
+
+        auto f = ov::test::snippets::MaxSubtractSinhFunction({inputShape0});
+        function = f.getOriginal();
+    }
+
+    void ExpMeanReduceEltwise::SetUp() {
+        ov::Shape inputShape0;
+        std::tie(inputShape0, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+        init_input_shapes({{{}, {inputShape0, }}});
+
+        auto f = ov::test::snippets::ExpMeanSinhFunction({inputShape0});
+        function = f.getOriginal();
+    }
+
+TEST_P(SoftmaxReduceEltwise, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(LayerNormReduceEltwise, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(MaxSubtractReduceEltwise, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(ExpMeanReduceEltwise, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -125,6 +125,76 @@ protected:
     std::shared_ptr<ov::Model> initOriginal() const override;
     std::shared_ptr<ov::Model> initReference() const override;
 };
+/// Softmax over the innermost dimension decomposed into reductions and eltwises.
+/// Sinh is used to WA CPU-specific disabling after inputs, see AddSinh for details.
+/// Tokenized by attaching the reductions and the eltwises to a single subgraph.
+//       in1
+//       Sinh
+//   ReduceMax  |
+//       Subtract
+//          Exp
+//   ReduceSum  |
+//        Divide
+//        Result
+class SoftmaxSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit SoftmaxSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+            NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+};
+/// Layer normalization over the innermost dimension decomposed into reductions and eltwises.
+/// Sinh is used to WA CPU-specific disabling after inputs, see AddSinh for details.
+//       in1
+//       Sinh
+//  ReduceMean  |
+//       Subtract
+//       Multiply
+//  ReduceMean  |
+//  Add(eps)    |
+//  Sqrt        |
+//        Divide
+//        Result
+class LayerNormSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit LayerNormSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+            NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+/// Subtraction of the row maximum, the result depends on the value of every lane of the reduced maximum.
+/// Sinh is used to WA CPU-specific disabling after inputs, see AddSinh for details.
+//       in1
+//       Sinh
+//   ReduceMax  |
+//       Subtract
+//        Result
+class MaxSubtractSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit MaxSubtractSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+            NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+/// Mean of the exponents, the reduction is the output of the subgraph, so a single value is stored per row.
+/// Sinh is used to WA CPU-specific disabling after inputs, see AddSinh for details.
+//       in1
+//       Sinh
+//        Exp
+//  ReduceMean
+//     Result
+class ExpMeanSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit ExpMeanSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+            NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
 
 }  // namespace snippets
 }  // namespace test
@@ -187,6 +187,59 @@ std::shared_ptr<ov::Model> EltwiseLogLoopFunction::initReference() const {
     return std::make_shared<Model>(NodeVector{mul}, ParameterVector{data0, data1});
 }
 
+namespace {
+std::shared_ptr<op::v0::Constant> makeLastAxis() {
+    return op::v0::Constant::create(ov::element::i64, Shape{1}, {-1});
+}
+std::shared_ptr<Node> makeSoftmax(const Output<Node>& data) {
+    auto max = std::make_shared<op::v1::ReduceMax>(data, makeLastAxis(), true);
+    auto sub = std::make_shared<op::v1::Subtract>(data, max);
+    auto exp = std::make_shared<op::v0::Exp>(sub);
+    auto sum = std::make_shared<op::v1::ReduceSum>(exp, makeLastAxis(), true);
+    return std::make_shared<op::v1::Divide>(exp, sum);
+}
+} // namespace
+
+std::shared_ptr<ov::Model> SoftmaxSinhFunction::initOriginal() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data);
+    return std::make_shared<ov::Model>(NodeVector{makeSoftmax(sinh)}, ParameterVector{data});
+}
+std::shared_ptr<ov::Model> SoftmaxSinhFunction::initReference() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data);
+    auto indata = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto subgraph = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{sinh},
+                                          std::make_shared<ov::Model>(NodeVector{makeSoftmax(indata)}, ParameterVector{indata}));
+    return std::make_shared<ov::Model>(NodeVector{subgraph}, ParameterVector{data});
+}
+std::shared_ptr<ov::Model> LayerNormSinhFunction::initOriginal() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data);
+    auto mean = std::make_shared<op::v1::ReduceMean>(sinh, makeLastAxis(), true);
+    auto centered = std::make_shared<op::v1::Subtract>(sinh, mean);
+    auto sqr = std::make_shared<op::v1::Multiply>(centered, centered);
+    auto var = std::make_shared<op::v1::ReduceMean>(sqr, makeLastAxis(), true);
+    auto eps = op::v0::Constant::create(precision, Shape{1}, {1e-5f});
+    auto stddev = std::make_shared<op::v0::Sqrt>(std::make_shared<op::v1::Add>(var, eps));
+    auto norm = std::make_shared<op::v1::Divide>(centered, stddev);
+    return std::make_shared<ov::Model>(NodeVector{norm}, ParameterVector{data});
+}
+std::shared_ptr<ov::Model> MaxSubtractSinhFunction::initOriginal() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data);
+    auto max = std::make_shared<op::v1::ReduceMax>(sinh, makeLastAxis(), true);
+    auto sub = std::make_shared<op::v1::Subtract>(sinh, max);
+    return std::make_shared<ov::Model>(NodeVector{sub}, ParameterVector{data});
+}
+std::shared_ptr<ov::Model> ExpMeanSinhFunction::initOriginal() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data);
+    auto exp = std::make_shared<op::v0::Exp>(sinh);
+    auto mean = std::make_shared<op::v1::ReduceMean>(exp, makeLastAxis(), true);
+    return std::make_shared<ov::Model>(NodeVector{mean}, ParameterVector{data});
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
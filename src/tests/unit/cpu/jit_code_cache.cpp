@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "cache/jit_code_cache.h"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace ov::intel_cpu;
+using namespace dnnl::impl::cpu::x64;
+
+namespace {
+
+int64_t externalValue = 7;
+
+// returns the value from the table placed after the code, the table is addressed by an absolute address
+struct jit_table_kernel : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_table_kernel)
+
+    typedef int64_t (*function_t)();
+
+    explicit jit_table_kernel(int64_t value) : value_(value) {}
+
+    void generate() override {
+        Xbyak::Label table;
+        mov(rax, table);
+        mov(rax, ptr[rax]);
+        ret();
+        align(8);
+        L(table);
+        dq(value_);
+    }
+
+    int64_t value_;
+};
+
+// reads a variable of the process, the code must not be reused by another process
+struct jit_external_kernel : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_external_kernel)
+
+    void generate() override {
+        mov(rax, reinterpret_cast<size_t>(&externalValue));
+        mov(rax, ptr[rax]);
+        ret();
+    }
+};
+
+template <typename KernelT, typename... Args>
+JitCodeCache::GeneratorFactory makeFactory(size_t& generated, Args... args) {
+    return [&generated, args...]() {
+        auto kernel = std::make_shared<KernelT>(args...);
+        EXPECT_EQ(kernel->create_kernel(), dnnl::impl::status::success);
+        generated++;
+        return kernel;
+    };
+}
+
+int64_t run(const JitCodePtr& code) {
+    return reinterpret_cast<jit_table_kernel::function_t>(code->get())();
+}
+
+class JitCodeCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CommonTestUtils::createDirectory(cacheDir);
+        if (!JitCodeCache::get(cacheDir))
+            GTEST_SKIP() << "Persistent JIT code cache is not supported on the platform";
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    const std::string cacheDir = "jit_code_cache_test";
+};
+
+} // namespace
+
+TEST_F(JitCodeCacheTests, StoreAndLoad) {
+    size_t generated = 0;
+    {
+        JitCodeCache cache(cacheDir);
+        auto code = cache.getOrCreate("table_42", makeFactory<jit_table_kernel>(generated, 42));
+        ASSERT_NE(code, nullptr);
+        ASSERT_FALSE(code->isLoaded());
+        ASSERT_EQ(run(code), 42);
+    }
+    ASSERT_EQ(generated, 2u);
+
+    // a new instance emulates the next process, the code must be read from the disk and relocated
+    JitCodeCache cache(cacheDir);
+    auto code = cache.getOrCreate("table_42", makeFactory<jit_table_kernel>(generated, 42));
+    ASSERT_TRUE(code->isLoaded());
+    ASSERT_EQ(generated, 2u);
+    ASSERT_EQ(run(code), 42);
+
+    // the loaded code is shared while it is alive
+    auto sameCode = cache.getOrCreate("table_42", makeFactory<jit_table_kernel>(generated, 42));
+    ASSERT_EQ(code, sameCode);
+
+    auto otherCode = cache.getOrCreate("table_13", makeFactory<jit_table_kernel>(generated, 13));
+    ASSERT_EQ(generated, 4u);
+    ASSERT_EQ(run(otherCode), 13);
+}
+
+TEST_F(JitCodeCacheTests, ExternalAddressIsNotStored) {
+    size_t generated = 0;
+    for (int i = 0; i < 2; i++) {
+        JitCodeCache cache(cacheDir);
+        auto code = cache.getOrCreate("external", makeFactory<jit_external_kernel>(generated));
+        ASSERT_FALSE(code->isLoaded());
+        ASSERT_EQ(run(code), externalValue);
+    }
+    ASSERT_EQ(generated, 4u);
+
+    // the kernel which has failed to be stored is generated once by the next misses
+    JitCodeCache cache(cacheDir);
+    cache.getOrCreate("external", makeFactory<jit_external_kernel>(generated));
+    ASSERT_EQ(generated, 6u);
+    auto code = cache.getOrCreate("external", makeFactory<jit_external_kernel>(generated));
+    ASSERT_EQ(generated, 7u);
+    ASSERT_EQ(run(code), externalValue);
+}
+
+TEST_F(JitCodeCacheTests, CorruptedSizeIsNotLoaded) {
+    size_t generated = 0;
+    {
+        JitCodeCache cache(cacheDir);
+        cache.getOrCreate("table_42", makeFactory<jit_table_kernel>(generated, 42));
+    }
+    const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_EQ(blobs.size(), 1u);
+
+    // the code size in the header exceeds the blob, it must be rejected before the allocation
+    {
+        std::fstream blob(blobs.front(), std::ios::in | std::ios::out | std::ios::binary);
+        const uint64_t codeSize = 1ull << 60;
+        const size_t codeSizeOffset = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+        blob.seekp(codeSizeOffset);
+        blob.write(reinterpret_cast<const char*>(&codeSize), sizeof(codeSize));
+    }
+
+    JitCodeCache cache(cacheDir);
+    JitCodePtr code;
+    ASSERT_NO_THROW(code = cache.getOrCreate("table_42", makeFactory<jit_table_kernel>(generated, 42)));
+    ASSERT_FALSE(code->isLoaded());
+    ASSERT_EQ(run(code), 42);
+}
+
+TEST_F(JitCodeCacheTests, EmptyKeyDisablesCaching) {
+    size_t generated = 0;
+    JitCodeCache cache(cacheDir);
+    auto code = cache.getOrCreate("", makeFactory<jit_table_kernel>(generated, 42));
+    ASSERT_FALSE(code->isLoaded());
+    ASSERT_EQ(generated, 1u);
+    ASSERT_EQ(run(code), 42);
+}
@@ -15,6 +15,8 @@
 #include <ngraph_transformations/fc_bias_fusion.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
 #include <ngraph/pass/manager.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -261,6 +263,53 @@ TEST(TransformationTests, ConvertMatMulToFCTest10) {
     ASSERT_NO_THROW(m.run_passes(f));
 }
 
+TEST(TransformationTests, ConvertMatMulToFCCompressedWeightsTest) {
+    auto makeFunction = [](bool keepConstPrecision) {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f16, ngraph::Shape{ 2, 2 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        if (keepConstPrecision)
+            ov::enable_keep_const_precision(weights);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, convert, false, false);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    };
+    auto countFC = [](const std::shared_ptr<ngraph::Function>& f) {
+        size_t count = 0;
+        for (auto&& node : f->get_ops())
+            count += std::dynamic_pointer_cast<FullyConnectedNode>(node) ? 1 : 0;
+        return count;
+    };
+
+    // the compressed weights are disabled in the config
+    {
+        auto f = makeFunction(true);
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ConvertMatMulToFC>(false);
+        ASSERT_NO_THROW(m.run_passes(f));
+        ASSERT_EQ(countFC(f), 0u);
+    }
+    // the Convert is excluded from ConstantFolding (e.g. by LPT) but the Constant doesn't keep its precision
+    {
+        auto f = makeFunction(false);
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ConvertMatMulToFC>(true);
+        ASSERT_NO_THROW(m.run_passes(f));
+        ASSERT_EQ(countFC(f), 0u);
+    }
+    {
+        auto f = makeFunction(true);
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ConvertMatMulToFC>(true);
+        ASSERT_NO_THROW(m.run_passes(f));
+        ASSERT_NO_THROW(check_rt_info(f));
+        ASSERT_EQ(countFC(f), 1u);
+    }
+}
+
 TEST(TransformationTests, FullyConnectedBiasFusionTest1) {
     std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
     {
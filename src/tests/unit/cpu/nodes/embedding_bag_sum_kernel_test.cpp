@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_common.h>
+
+#include <cmath>
+#include <random>
+
+#include <nodes/embedding_bag_sum.h>
+#include "utils/bfloat16.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::node;
+using namespace InferenceEngine;
+
+namespace {
+
+/*
+ * Test the gather-accumulate kernel of EmbeddingBag* nodes against the reference FP32 accumulation.
+ */
+typedef std::tuple<
+        Precision,  // table precision
+        size_t,     // embedding depth
+        bool>       // with per sample weights
+        EmbBagSumKernelTestParamSet;
+
+float toFloat(const void* data, const Precision& prc, size_t i) {
+    if (prc == Precision::BF16)
+        return static_cast<float>(static_cast<const bfloat16_t*>(data)[i]);
+    return static_cast<const float*>(data)[i];
+}
+
+std::vector<uint8_t> makeData(const Precision& prc, size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<uint8_t> data(size * prc.size());
+    for (size_t i = 0; i < size; i++) {
+        if (prc == Precision::BF16)
+            reinterpret_cast<bfloat16_t*>(data.data())[i] = bfloat16_t(dist(gen));
+        else
+            reinterpret_cast<float*>(data.data())[i] = dist(gen);
+    }
+    return data;
+}
+
+class EmbBagSumKernelTest : public ::testing::TestWithParam<EmbBagSumKernelTestParamSet> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbBagSumKernelTestParamSet> &obj) {
+        Precision prc;
+        size_t depth;
+        bool withWeights;
+        std::tie(prc, depth, withWeights) = obj.param;
+        std::ostringstream result;
+        result << "Prc=" << prc.name() << "_Depth=" << depth << "_Weights=" << withWeights;
+        return result.str();
+    }
+};
+
+} // namespace
+
+TEST_P(EmbBagSumKernelTest, CompareWithRefs) {
+    jit_emb_bag_config_params jcp;
+    std::tie(jcp.src_prc, jcp.emb_depth, jcp.with_weights) = GetParam();
+
+    auto kernel = jit_uni_emb_bag_sum_kernel::create(jcp);
+    if (!kernel)
+        GTEST_SKIP() << "The kernel is not supported on the platform";
+
+    constexpr size_t rows = 50;
+    std::mt19937 gen(42);
+    const auto table = makeData(jcp.src_prc, rows * jcp.emb_depth, gen);
+
+    std::uniform_int_distribution<int> indexDist(0, rows - 1);
+    // the bag sizes cover the prefetch distance boundary
+    for (size_t bagSize : {0, 1, 3, 8, 9, 33}) {
+        std::vector<int> indices(bagSize);
+        for (auto& index : indices)
+            index = indexDist(gen);
+        const auto weights = makeData(jcp.src_prc, bagSize, gen);
+        std::vector<uint8_t> dst(jcp.emb_depth * jcp.src_prc.size(), 0xff);
+
+        jit_emb_bag_call_args args;
+        args.src = table.data();
+        args.indices = indices.data();
+        args.weights = weights.data();
+        args.dst = dst.data();
+        args.indices_num = bagSize;
+        (*kernel)(&args);
+
+        for (size_t i = 0; i < jcp.emb_depth; i++) {
+            float ref = 0.f;
+            for (size_t j = 0; j < bagSize; j++) {
+                const float value = toFloat(table.data(), jcp.src_prc, indices[j] * jcp.emb_depth + i);
+                ref += jcp.with_weights ? value * toFloat(weights.data(), jcp.src_prc, j) : value;
+            }
+            const float eps = jcp.src_prc == Precision::BF16 ? 1e-2f * std::max(1.f, std::abs(ref)) : 1e-5f;
+            ASSERT_NEAR(toFloat(dst.data(), jcp.src_prc, i), ref, eps) << "bag size: " << bagSize << " element: " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbBagSumKernel, EmbBagSumKernelTest,
+                         ::testing::Combine(::testing::Values(Precision::FP32, Precision::BF16),
+                                            ::testing::Values(1, 7, 16, 100, 128, 257),
+                                            ::testing::Values(false, true)),
+                         EmbBagSumKernelTest::getTestCaseName);
@@ -3,6 +3,8 @@
 //
 
 #include <thread>
+#include <atomic>
+#include <chrono>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -379,3 +381,78 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, ThreadSafeGetOrCreate) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 64;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 32;
+
+    std::atomic<size_t> buildCount{0};
+    auto intBuilder = [&](const IntKey& key) {
+        buildCount++;
+        // make the concurrent requests of the same key overlap
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity, true, 4);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numKeys; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // each key is built only once, the other threads wait for the result in flight
+    ASSERT_EQ(buildCount.load(), static_cast<size_t>(numKeys));
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.misses, static_cast<uint64_t>(numKeys));
+    ASSERT_EQ(stats.hits, static_cast<uint64_t>(numThreads * numKeys - numKeys));
+}
+
+TEST(MultiCacheTests, ThreadSafeBuilderException) {
+    MultiCache cache(10, true);
+
+    auto throwingBuilder = [](const IntKey& key) -> std::shared_ptr<int> {
+        throw std::runtime_error("build failed");
+    };
+    auto intBuilder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    ASSERT_THROW(cache.getOrCreate(IntKey{1}, throwingBuilder), std::runtime_error);
+
+    // the failed build must not leave the key in flight
+    auto intResult = cache.getOrCreate(IntKey{1}, intBuilder);
+    ASSERT_EQ(*intResult.first, 1);
+    ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
+}
+
+TEST(MultiCacheTests, ThreadSafeCopySharesRecords) {
+    auto intBuilder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(10, true);
+    MultiCache copy(cache);
+
+    // the entry is created after the copy, but the records are still shared
+    ASSERT_EQ(copy.getOrCreate(IntKey{1}, intBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(cache.getOrCreate(IntKey{1}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(cache.getOrCreate(IntKey{1}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+
+    // each instance counts only its own requests
+    ASSERT_EQ(copy.getStatistics().misses, 1u);
+    ASSERT_EQ(copy.getStatistics().hits, 0u);
+    ASSERT_EQ(cache.getStatistics().misses, 0u);
+    ASSERT_EQ(cache.getStatistics().hits, 2u);
+}
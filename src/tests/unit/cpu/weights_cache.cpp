@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "weights_cache.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+const unsigned char* bytes(const char* str) {
+    return reinterpret_cast<const unsigned char*>(str);
+}
+
+MemoryPtr makeMemory(const dnnl::engine& eng, float value) {
+    auto memory = std::make_shared<Memory>(eng);
+    memory->Create(CpuBlockedMemoryDesc(InferenceEngine::Precision::FP32, Shape(InferenceEngine::SizeVector{16})));
+    std::fill_n(static_cast<float*>(memory->GetData()), 16, value);
+    return memory;
+}
+
+} // namespace
+
+TEST(WeightsCacheHashTests, ReferenceValues) {
+    const auto& hash = WeightsSharing::GetHashFunc();
+    ASSERT_EQ(hash.hash(bytes(""), 0), 0xef46db3751d8e999ull);
+    ASSERT_EQ(hash.hash(bytes("abc"), 3), 0x44bc2cf5ad770999ull);
+}
+
+TEST(WeightsCacheHashTests, ChunkedHashIsDeterministic) {
+    const auto& hash = WeightsSharing::GetHashFunc();
+    // several chunks and the tail, all the tails of the serial hash are covered by the sizes below
+    std::vector<unsigned char> data((3 << 20) + 45);
+    std::iota(data.begin(), data.end(), 0);
+
+    const auto reference = hash.hash(data.data(), data.size());
+    ASSERT_EQ(hash.hash(data.data(), data.size()), reference);
+
+    data[(2 << 20) + 7] ^= 1;
+    ASSERT_NE(hash.hash(data.data(), data.size()), reference);
+
+    for (size_t size : {1, 4, 7, 8, 15, 31, 32, 33, 63, 64, 100}) {
+        ASSERT_NE(hash.hash(data.data(), size), hash.hash(data.data(), size + 1)) << "size: " << size;
+    }
+}
+
+TEST(WeightsCacheTests, ContentIsSharedBetweenNetworks) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto network1 = std::make_shared<WeightsSharing>(0);
+    auto network2 = std::make_shared<WeightsSharing>(0);
+    auto otherNumaNode = std::make_shared<WeightsSharing>(1);
+
+    size_t created = 0;
+    auto create = [&]() {
+        created++;
+        return makeMemory(eng, 1.f);
+    };
+    auto contentKey = []() { return std::string("weights_content_sharing_test"); };
+
+    MemoryPtr memory1 = *network1->findOrCreate("conv1_weights", contentKey, create);
+    MemoryPtr memory2 = *network2->findOrCreate("other_name", contentKey, create);
+    ASSERT_EQ(created, 1u);
+    ASSERT_EQ(memory1, memory2);
+
+    // the memory is found by the name in the network cache
+    MemoryPtr memory2Name = *network2->get("other_name");
+    ASSERT_EQ(memory2Name, memory1);
+
+    MemoryPtr memoryNuma = *otherNumaNode->findOrCreate("conv1_weights", contentKey, create);
+    ASSERT_EQ(created, 2u);
+    ASSERT_NE(memoryNuma, memory1);
+
+    // the memory is released with the last user and created again
+    memory1.reset();
+    memory2.reset();
+    memory2Name.reset();
+    MemoryPtr memory3 = *network2->findOrCreate("another_name", contentKey, create);
+    ASSERT_EQ(created, 3u);
+}
+
+TEST(WeightsCacheTests, EmptyContentKeyIsNotShared) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto network1 = std::make_shared<WeightsSharing>(0);
+    auto network2 = std::make_shared<WeightsSharing>(0);
+
+    size_t created = 0;
+    auto create = [&]() {
+        created++;
+        return makeMemory(eng, 2.f);
+    };
+    auto contentKey = []() { return std::string(); };
+
+    MemoryPtr memory1 = *network1->findOrCreate("weights", contentKey, create);
+    MemoryPtr memory2 = *network2->findOrCreate("weights", contentKey, create);
+    ASSERT_EQ(created, 2u);
+    ASSERT_NE(memory1, memory2);
+}
+
+TEST(WeightsCacheTests, CollidingContentIsNotShared) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto network1 = std::make_shared<WeightsSharing>(0);
+    auto network2 = std::make_shared<WeightsSharing>(0);
+
+    auto contentKey = []() { return std::string("weights_collision_test"); };
+    auto sameContent = [](float value) {
+        return [value](const Memory& memory) { return static_cast<const float*>(memory.GetPtr())[0] == value; };
+    };
+
+    MemoryPtr memory1 = *network1->findOrCreate("weights", contentKey, [&] { return makeMemory(eng, 1.f); }, true,
+                                                sameContent(1.f));
+    // the same hash, but the other data
+    MemoryPtr memory2 = *network2->findOrCreate("weights", contentKey, [&] { return makeMemory(eng, 2.f); }, true,
+                                                sameContent(2.f));
+    ASSERT_NE(memory1, memory2);
+    ASSERT_EQ(static_cast<const float*>(memory2->GetPtr())[0], 2.f);
+}
+
+TEST(WeightsCacheTests, ContentIsCreatedConcurrently) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto network1 = std::make_shared<WeightsSharing>(0);
+    auto network2 = std::make_shared<WeightsSharing>(0);
+
+    // each creation waits for the other one, so they can't be serialized by the cache
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t inCreation = 0;
+    auto create = [&](float value) {
+        std::unique_lock<std::mutex> lock(mutex);
+        inCreation++;
+        cv.notify_all();
+        EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&] { return inCreation == 2; }));
+        return makeMemory(eng, value);
+    };
+
+    MemoryPtr memory1, memory2;
+    std::thread thread1([&] {
+        memory1 = *network1->findOrCreate("weights", [] { return std::string("weights_concurrent_test_1"); },
+                                          [&] { return create(1.f); });
+    });
+    std::thread thread2([&] {
+        memory2 = *network2->findOrCreate("weights", [] { return std::string("weights_concurrent_test_2"); },
+                                          [&] { return create(2.f); });
+    });
+    thread1.join();
+    thread2.join();
+    ASSERT_EQ(static_cast<const float*>(memory1->GetPtr())[0], 1.f);
+    ASSERT_EQ(static_cast<const float*>(memory2->GetPtr())[0], 2.f);
+}
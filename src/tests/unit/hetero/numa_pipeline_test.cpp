@@ -0,0 +1,159 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include "numa_pipeline.hpp"
+
+using namespace ngraph;
+using HeteroPlugin::SplitIntoStages;
+
+namespace {
+
+// the bandwidth the tensors of the tests are passed with in no time
+constexpr double fastBandwidth = 1e9;
+
+// Param[1, 1] -> Relu (op0) -> ... -> Relu (opN) -> Result
+std::shared_ptr<Function> makeChain(size_t opsNumber) {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 1});
+    std::shared_ptr<Node> last = param;
+    for (size_t i = 0; i < opsNumber; i++) {
+        last = std::make_shared<opset8::Relu>(last);
+        last->set_friendly_name("op" + std::to_string(i));
+    }
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset8::Result>(last)}, ParameterVector{param});
+}
+
+// checks that each operation is split and the stages follow the order of the operations
+void checkStages(const std::shared_ptr<Function>& function, const std::map<std::string, size_t>& stages,
+                 size_t stagesNumber) {
+    size_t previousStage = 0;
+    for (auto&& node : function->get_ordered_ops()) {
+        const auto itStage = stages.find(node->get_friendly_name());
+        if (op::is_parameter(node) || op::is_constant(node) || op::is_output(node)) {
+            ASSERT_EQ(itStage, stages.end()) << node->get_friendly_name();
+            continue;
+        }
+        ASSERT_NE(itStage, stages.end()) << node->get_friendly_name();
+        ASSERT_LT(itStage->second, stagesNumber) << node->get_friendly_name();
+        ASSERT_GE(itStage->second, previousStage) << node->get_friendly_name();
+        previousStage = itStage->second;
+    }
+}
+
+double longestStageLatency(const std::map<std::string, size_t>& stages,
+                           const std::map<std::string, double>& latencies) {
+    std::map<size_t, double> stageLatencies;
+    for (auto&& stage : stages) {
+        const auto itLatency = latencies.find(stage.first);
+        stageLatencies[stage.second] += itLatency != latencies.end() ? itLatency->second : 0.;
+    }
+    double longest = 0.;
+    for (auto&& stage : stageLatencies)
+        longest = std::max(longest, stage.second);
+    return longest;
+}
+
+}  // namespace
+
+TEST(HeteroNumaPipelineTest, NoOperationsAreNotSplit) {
+    ASSERT_TRUE(SplitIntoStages({}, {}, 2, fastBandwidth).empty());
+
+    // the parameters, constants and results are not split
+    auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 1});
+    auto constant = opset8::Constant::create(element::f32, Shape{1, 1}, {1.f});
+    auto function = std::make_shared<Function>(ResultVector{std::make_shared<opset8::Result>(param),
+                                                            std::make_shared<opset8::Result>(constant)},
+                                               ParameterVector{param});
+    ASSERT_TRUE(SplitIntoStages(function->get_ordered_ops(), {}, 2, fastBandwidth).empty());
+}
+
+TEST(HeteroNumaPipelineTest, NoStagesAreNotSplit) {
+    const auto function = makeChain(4);
+    ASSERT_TRUE(SplitIntoStages(function->get_ordered_ops(), {{"op0", 10.}}, 0, fastBandwidth).empty());
+}
+
+TEST(HeteroNumaPipelineTest, SingleStageTakesAllOperations) {
+    const auto function = makeChain(4);
+    const auto stages = SplitIntoStages(function->get_ordered_ops(), {{"op0", 10.}, {"op3", 10.}}, 1, fastBandwidth);
+    ASSERT_EQ(stages.size(), 4u);
+    checkStages(function, stages, 1);
+}
+
+TEST(HeteroNumaPipelineTest, EqualLatenciesAreSplitEvenly) {
+    const auto function = makeChain(4);
+    const std::map<std::string, double> latencies{{"op0", 10.}, {"op1", 10.}, {"op2", 10.}, {"op3", 10.}};
+    const auto stages = SplitIntoStages(function->get_ordered_ops(), latencies, 2, fastBandwidth);
+    const std::map<std::string, size_t> expected{{"op0", 0}, {"op1", 0}, {"op2", 1}, {"op3", 1}};
+    ASSERT_EQ(stages, expected);
+}
+
+TEST(HeteroNumaPipelineTest, LongestOperationBoundsStages) {
+    const auto function = makeChain(5);
+    const std::map<std::string, double> latencies{{"op0", 5.}, {"op1", 100.}, {"op2", 5.}, {"op3", 5.}, {"op4", 5.}};
+    const auto stages = SplitIntoStages(function->get_ordered_ops(), latencies, 3, fastBandwidth);
+    checkStages(function, stages, 3);
+    ASSERT_NEAR(longestStageLatency(stages, latencies), 100., 1e-3);
+}
+
+TEST(HeteroNumaPipelineTest, MoreStagesThanOperations) {
+    const auto function = makeChain(2);
+    const std::map<std::string, double> latencies{{"op0", 10.}, {"op1", 10.}};
+    const auto stages = SplitIntoStages(function->get_ordered_ops(), latencies, 4, fastBandwidth);
+    const std::map<std::string, size_t> expected{{"op0", 0}, {"op1", 1}};
+    ASSERT_EQ(stages, expected);
+}
+
+TEST(HeteroNumaPipelineTest, FusedOperationsTakeNoTime) {
+    // op1 is fused and has the zero latency, op2 is missing in the profile
+    const auto function = makeChain(4);
+    const std::map<std::string, double> latencies{{"op0", 30.}, {"op1", 0.}, {"op3", 30.}};
+    const auto stages = SplitIntoStages(function->get_ordered_ops(), latencies, 2, fastBandwidth);
+    checkStages(function, stages, 2);
+    ASSERT_EQ(stages.at("op0"), 0u);
+    ASSERT_EQ(stages.at("op3"), 1u);
+    ASSERT_NEAR(longestStageLatency(stages, latencies), 30., 1e-3);
+}
+
+TEST(HeteroNumaPipelineTest, LargeTensorsAreNotPassedBetweenStages) {
+    /* The even split passes the large tensor of op1 between the stages, the stages are cut after op2 reducing it
+
+        Param[1, 1] -> Broadcast[1, 1000] (op0) -> Relu[1, 1000] (op1) -> ReduceSum[1, 1] (op2) -> Relu[1, 1] (op3)
+    */
+    auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 1});
+    auto broadcast =
+        std::make_shared<opset8::Broadcast>(param, opset8::Constant::create(element::i64, Shape{2}, {1, 1000}));
+    broadcast->set_friendly_name("op0");
+    auto relu = std::make_shared<opset8::Relu>(broadcast);
+    relu->set_friendly_name("op1");
+    auto reduce =
+        std::make_shared<opset8::ReduceSum>(relu, opset8::Constant::create(element::i64, Shape{1}, {1}), true);
+    reduce->set_friendly_name("op2");
+    auto last = std::make_shared<opset8::Relu>(reduce);
+    last->set_friendly_name("op3");
+    auto function =
+        std::make_shared<Function>(ResultVector{std::make_shared<opset8::Result>(last)}, ParameterVector{param});
+
+    const std::map<std::string, double> latencies{{"op0", 10.}, {"op1", 10.}, {"op2", 10.}, {"op3", 10.}};
+    // 4000 bytes take 1000 us, 4 bytes take 1 us
+    const double bytesPerMicrosecond = 4.;
+    const auto stages = SplitIntoStages(function->get_ordered_ops(), latencies, 2, bytesPerMicrosecond);
+    const std::map<std::string, size_t> expected{{"op0", 0}, {"op1", 0}, {"op2", 0}, {"op3", 1}};
+    ASSERT_EQ(stages, expected);
+
+    // the large tensor is passed in no time, the even split is back
+    const auto fastStages = SplitIntoStages(function->get_ordered_ops(), latencies, 2, fastBandwidth);
+    const std::map<std::string, size_t> fastExpected{{"op0", 0}, {"op1", 0}, {"op2", 1}, {"op3", 1}};
+    ASSERT_EQ(fastStages, fastExpected);
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "ie_cache_manager.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+
+class FileStorageCacheManagerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CommonTestUtils::createDirectory(cacheDir);
+        cacheManager = std::make_shared<FileStorageCacheManager>(cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "tmp");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    void write(const std::string& content) {
+        cacheManager->writeCacheEntry(blobId, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    const std::string cacheDir = "file_storage_cache_manager_test";
+    const std::string blobId = "entry";
+    std::shared_ptr<ICacheManager> cacheManager;
+};
+
+TEST_F(FileStorageCacheManagerTests, EntryIsMapped) {
+    write("header_data");
+
+    bool isRead = false;
+    cacheManager->readCacheEntry(blobId, [&](std::istream& stream) {
+        auto mapped = dynamic_cast<ov::MappedStreamBuffer*>(stream.rdbuf());
+        ASSERT_NE(mapped, nullptr);
+
+        std::string header(6, '\0');
+        stream.read(&header[0], header.size());
+        ASSERT_EQ(header, "header");
+        ASSERT_EQ(stream.tellg(), 6);
+
+        // the data is referred in place
+        const auto data = mapped->mapping()->get_ptr<char>() + stream.tellg();
+        ASSERT_EQ(std::string(data, 5), "_data");
+
+        stream.seekg(-4, std::ios_base::end);
+        std::string tail;
+        stream >> tail;
+        ASSERT_EQ(tail, "data");
+        isRead = true;
+    });
+    ASSERT_TRUE(isRead);
+}
+
+TEST_F(FileStorageCacheManagerTests, MappingSurvivesRewrite) {
+    write("first");
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> mapping;
+    cacheManager->readCacheEntry(blobId, [&](std::istream& stream) {
+        auto mapped = dynamic_cast<ov::MappedStreamBuffer*>(stream.rdbuf());
+        ASSERT_NE(mapped, nullptr);
+        mapping = mapped->mapping();
+    });
+    ASSERT_NE(mapping, nullptr);
+
+    // the entry is replaced by another process while the mapping is used
+    write("second");
+
+    ASSERT_EQ(std::string(mapping->get_ptr<char>(), mapping->size()), "first");
+    cacheManager->readCacheEntry(blobId, [&](std::istream& stream) {
+        std::string content;
+        stream >> content;
+        ASSERT_TRUE(content == "second" || content == "first");
+    });
+}
+
+TEST_F(FileStorageCacheManagerTests, MissedEntryIsNotRead) {
+    bool isRead = false;
+    cacheManager->readCacheEntry("missed", [&](std::istream&) {
+        isRead = true;
+    });
+    ASSERT_FALSE(isRead);
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteLeavesNoFiles) {
+    ASSERT_THROW(cacheManager->writeCacheEntry(blobId, [&](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("the export failed");
+    }), std::runtime_error);
+
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(cacheDir, "tmp").empty());
+    bool isRead = false;
+    cacheManager->readCacheEntry(blobId, [&](std::istream&) {
+        isRead = true;
+    });
+    ASSERT_FALSE(isRead);
+}
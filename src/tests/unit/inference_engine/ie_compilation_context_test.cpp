@@ -13,6 +13,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -380,6 +381,67 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentResults) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static CNNNetwork createNetworkWithLargeConstant(size_t changedByte) {
+    // several chunks of the constant data are hashed
+    std::vector<int8_t> values((3 << 20) + 5, 1);
+    values[changedByte] = 2;
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{values.size()});
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{values.size()}, values);
+    auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithConstantData) {
+    auto net1 = createNetworkWithLargeConstant(0);
+    auto net2 = createNetworkWithLargeConstant((2 << 20) + 3);
+    auto net3 = createNetworkWithLargeConstant((2 << 20) + 3);
+    const auto hash1 = NetworkCompilationContext::computeHash(net1, {});
+    const auto hash2 = NetworkCompilationContext::computeHash(net2, {});
+    ASSERT_NE(hash1, hash2);
+    ASSERT_EQ(hash2, NetworkCompilationContext::computeHash(net3, {}));
+
+    // the digest is memoized by the caller and doesn't change the hash, the model is not modified
+    auto digests = std::make_shared<ov::ConstantDigestCache>();
+    std::shared_ptr<ngraph::opset6::Constant> constant;
+    for (const auto& op : net2.getFunction()->get_ops()) {
+        if (auto found = ov::as_type_ptr<ngraph::opset6::Constant>(op))
+            constant = found;
+    }
+    ASSERT_NE(constant, nullptr);
+    const auto rtInfoSize = constant->get_rt_info().size();
+    ASSERT_EQ(hash2, NetworkCompilationContext::computeHash(net2, {}, digests));
+    ASSERT_EQ(rtInfoSize, constant->get_rt_info().size());
+    uint64_t digest = 0;
+    ASSERT_TRUE(digests->find(constant, digest));
+    ASSERT_EQ(hash2, NetworkCompilationContext::computeHash(net2, {}, digests));
+
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithSharedConstantData) {
+    // the constant refers the memory of the user, which may be changed in place
+    std::vector<int8_t> values((3 << 20) + 5, 1);
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<void>>>(
+        reinterpret_cast<char*>(values.data()), values.size(), nullptr);
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{values.size()});
+    auto constant =
+        std::make_shared<ngraph::opset6::Constant>(ngraph::element::i8, ngraph::Shape{values.size()}, buffer);
+    auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    CNNNetwork net(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    ASSERT_TRUE(constant->is_data_shared());
+
+    // the digest of the shared data is not memoized, the data changed in place is hashed again
+    auto digests = std::make_shared<ov::ConstantDigestCache>();
+    const auto hash = NetworkCompilationContext::computeHash(net, {}, digests);
+    uint64_t digest = 0;
+    ASSERT_FALSE(digests->find(constant, digest));
+    values[(2 << 20) + 3] = 2;
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(net, {}, digests));
+    values[(2 << 20) + 3] = 1;
+    ASSERT_EQ(hash, NetworkCompilationContext::computeHash(net, {}, digests));
+}
+
 TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
     auto updatePreprocess = [&](CNNNetwork& cnnNet) {
         auto &preProcess = cnnNet.getInputsInfo().begin()->second->getPreProcess();